@@ -0,0 +1,193 @@
+#pragma once
+
+// Block floating point (FFT_BFP). Every pass measures the peak component of
+// the data it produces; the next pass shifts right by just enough bits that
+// its worst-case growth still fits cint16. The shifts of a frame add up to a
+// shared exponent (true spectrum = samples * 2^exponent) that travels in a
+// trailer of BFP_TRAILER samples after the data: trailer[0] = {exponent, peak}.
+// Without FFT_BFP every shift is 0 and the helpers compile away.
+
+#include <aie_api/aie.hpp>
+#include <aie_api/aie_adf.hpp>
+#include "definition.hpp"
+#include "fft_types.hpp"
+
+#ifdef FFT_BFP
+#define BFP_TRAILER MAX_VEC_LEN
+#else
+#define BFP_TRAILER 0
+#endif
+
+namespace bfp {
+
+using namespace aie;
+
+// Bits a pass can add to the peak component. Re/Im of a sum of n terms rotated
+// by unit twiddles stay below n*sqrt(2)*peak; the W_2 butterfly has no twiddle.
+template<unsigned P>
+constexpr unsigned dft_growth=P==2?1:P==4?3:4;
+constexpr unsigned R4_GROWTH=3; // two radix-2 levels, below 5.3*peak
+constexpr unsigned R2_GROWTH=2; // radix-2 level and the cross twiddle, below 2.9*peak
+
+// right shift that keeps a pass of the given growth inside cint16
+static inline unsigned shift(unsigned peak,unsigned growth)
+{
+#ifdef FFT_BFP
+    unsigned bits=0;
+    while (peak>>bits) bits++;
+    return bits+growth>15?bits+growth-15:0;
+#else
+    return 0;
+#endif
+}
+
+// Fractional bits windowed samples can carry into the first pass (window
+// gain <= 1). cint32 samples stay far below 2^31 for the spectrum to fit;
+// cint16 has the headroom of the input peak (window_scan).
+template<typename T>
+static inline unsigned guard(unsigned peak)
+{
+    if constexpr (std::is_same<T,cint32>::value)
+        return 12;
+    if constexpr (!std::is_same<T,cint16>::value)
+        return 0;
+    unsigned bits=0;
+    while (peak>>bits) bits++;
+    return bits<15?15-bits:0;
+}
+
+// running peak |Re|/|Im| of cint16 vectors, in every build
+template<unsigned V>
+class meter {
+    vector<int16,2*V> hi=zeros<int16,2*V>(),lo=zeros<int16,2*V>();
+public:
+    void update(const vector<cint16,V> &v)
+    {
+        auto c=v.template cast_to<int16>();
+        hi=max(hi,c);
+        lo=min(lo,c);
+    }
+    unsigned value() const
+    {
+        int h=reduce_max(hi),l=-reduce_min(lo);
+        return h>l?h:l;
+    }
+};
+
+// running peak |Re|/|Im| of the vectors a pass stores
+template<unsigned V, typename T=cint16>
+class peak {
+#ifdef FFT_BFP
+    static_assert(std::is_same<T,cint16>::value, "block floating point is a cint16 mode");
+    meter<V> m;
+public:
+    void update(const vector<cint16,V> &v) { m.update(v); }
+    unsigned value() const { return m.value(); }
+#else
+public:
+    void update(const vector<T,V> &){}
+    unsigned value() const { return 0; }
+#endif
+};
+
+// peak of an input window, or of LEN samples of it
+template<unsigned LEN=N_POINT, typename T>
+static inline unsigned scan(const T *x)
+{
+#ifdef FFT_BFP
+    peak<32> pk;
+    auto iter=begin_vector<32>(x);
+    for (unsigned i=0;i<LEN/32;i++) pk.update(*iter++);
+    return pk.value();
+#else
+    return 0;
+#endif
+}
+
+// peak of LEN cint16 samples for the window guard, with FFT_BFP or without
+// (scan() already has it with FFT_BFP); 0 for the wider types
+template<unsigned LEN, typename T>
+static inline unsigned window_scan(const T *x)
+{
+    if constexpr (std::is_same<T,cint16>::value)
+    {
+        meter<32> pk;
+        auto iter=begin_vector<32>(x);
+        for (unsigned i=0;i<LEN/32;i++) pk.update(*iter++);
+        return pk.value();
+    }
+    return 0;
+}
+
+// arithmetic right shift of the term that bypasses the twiddle multiply
+template<typename T, unsigned V>
+static inline vector<T,V> downshift(const vector<T,V> &v,unsigned s)
+{
+#ifdef FFT_BFP
+    accum<cacc48,V> acc;
+    acc.from_vector(v);
+    return acc.template to_vector<cint16>(s);
+#else
+    return v;
+#endif
+}
+
+static inline vector<cint16,MAX_VEC_LEN> trailer(int e,unsigned p)
+{
+    vector<cint16,MAX_VEC_LEN> v=zeros<cint16,MAX_VEC_LEN>();
+    v[0]={(int16)e,(int16)(p>32767?32767:p)};
+    return v;
+}
+
+// Right shift of a transform's output (out_shift RTP): the samples take it,
+// or with FFT_BFP the exponent e does and the samples keep their precision.
+// Returns the shift left for the samples.
+static inline unsigned scale(int out_shift,int &e)
+{
+#ifdef FFT_BFP
+    e-=out_shift;
+    return 0;
+#else
+    return out_shift;
+#endif
+}
+
+// y: end of the block
+template<typename T>
+static inline void write_trailer(T *y,int e,unsigned p)
+{
+#ifdef FFT_BFP
+    store_v(y,trailer(e,p));
+#endif
+}
+
+template<typename T>
+static inline void write_trailer(output_stream<T> *y,int e,unsigned p)
+{
+#ifdef FFT_BFP
+    writeincr(y,trailer(e,p));
+#endif
+}
+
+// Stage two brings its NUM_TILES inputs to the largest exponent: d[t] is the
+// extra shift of tile t, p the peak after alignment. Returns that exponent.
+// LEN: samples in front of the trailer (a slice of a split stage two).
+template<unsigned NUM_TILES, unsigned LEN=N_POINT, typename T>
+static inline int align(T * const *x,unsigned *d,unsigned &p)
+{
+    int e=0;
+    p=0;
+    for (unsigned t=0;t<NUM_TILES;t++) d[t]=0;
+#ifdef FFT_BFP
+    for (unsigned t=0;t<NUM_TILES;t++)
+        if (x[t][LEN].real>e) e=x[t][LEN].real;
+    for (unsigned t=0;t<NUM_TILES;t++){
+        d[t]=e-x[t][LEN].real;
+        unsigned pt=(unsigned)x[t][LEN].imag>>d[t];
+        if (pt>p) p=pt;
+    }
+#endif
+    return e;
+}
+
+} // namespace bfp
@@ -0,0 +1,28 @@
+#pragma once
+
+#define N_POINT 1024 // points per stage-one tile
+#define MAX_TILES 8 // widest stage-two decomposition that fits around one tile
+#define MAX_VEC_LEN 8
+#define MAX_VEC_LEN_HALF 4
+#define MAT_OMG_SHIFT 14
+#define OMG_SHIFT 14
+#define TF_SHIFT 14
+#define WIN_SHIFT 15 // window coefficients, Q0.15
+
+// window RTP of the stage-one kernels, applied to the input before the FFT
+#define WINDOW_NONE 0
+#define WINDOW_HANN 1
+#define WINDOW_BLACKMAN 2
+
+// direction RTP: FFT_INVERSE computes N * IDFT(x) = conj(DFT(conj(x))), the
+// stage-one tiles conjugate their input and the last stage its output
+#define FFT_FORWARD 0
+#define FFT_INVERSE 1
+
+// output_mode RTP of the 8-point stage two: complex bins, |X|^2 as bfloat16
+// or 10*log10(|X|^2) as int16 in 1/128 dB (see spectrum.hpp)
+#define FFT_OUT_COMPLEX 0
+#define FFT_OUT_POWER 1
+#define FFT_OUT_DB 2
+
+#include "fft_tables.hpp"
\ No newline at end of file
@@ -0,0 +1,444 @@
+#pragma once
+
+#include <adf.h>
+#include <string>
+#include <type_traits>
+#include "fft_kernel.hpp"
+#include "stage2_kernel.hpp"
+
+using namespace adf;
+
+// Centre column of the 3x3 placement ring of instance inst (8 tiles, cint16):
+// 23, 26, 20, 29, 17, ... so neighbouring instances share no tile.
+constexpr int ring_col(unsigned inst)
+{
+    return 23+3*(int)((inst+1)/2)*(inst%2?1:-1);
+}
+constexpr unsigned MAX_INSTANCES=8;
+
+// output windows of a stage-one tile: its bins are sliced like stage two
+template<unsigned NUM_TILES, typename T>
+constexpr unsigned TILE_OUT=NUM_TILES==1?1:S2_SLICES<NUM_TILES, T>;
+
+// One N_POINT stage-one tile of an NUM_TILES-way decomposition, its bins in
+// OUT output windows
+template<unsigned id, unsigned NUM_TILES, typename T, unsigned OUT=TILE_OUT<NUM_TILES, T>>
+class fft_tile_graph : public graph {
+private:
+    kernel fft_kernel;
+public:
+    static constexpr unsigned NUM_OUT=OUT;
+
+    port<input> in;
+    port<output> out[NUM_OUT];
+    port<input> window_type; // WINDOW_* run-time parameter
+    port<input> direction;   // FFT_FORWARD/INVERSE run-time parameter
+    port<input> out_shift;   // right shift of the result, NUM_TILES 1 only
+    port<input> band_lo;     // bins of the 8K spectrum stage two computes, NUM_TILES 8 only
+    port<input> band_hi;
+
+    // col: centre column of the placement ring
+    fft_tile_graph(int col=ring_col(0)){
+        if constexpr (NUM_OUT==1) fft_kernel=kernel::create(radix2_dit<id, NUM_TILES, T>);
+        else if constexpr (NUM_OUT==2) fft_kernel=kernel::create(radix2_dit_split<id, NUM_TILES, T>);
+        else fft_kernel=kernel::create(radix2_dit_split4<id, NUM_TILES, T>);
+
+        connect<window<N_POINT*sizeof(T)> >(in,fft_kernel.in[0]);
+        // the last value written holds until the next update
+        connect<parameter>(window_type,async(fft_kernel.in[1]));
+        connect<parameter>(direction,async(fft_kernel.in[2]));
+        connect<parameter>(out_shift,async(fft_kernel.in[3]));
+        connect<parameter>(band_lo,async(fft_kernel.in[4]));
+        connect<parameter>(band_hi,async(fft_kernel.in[5]));
+        // FFT_BFP appends the block exponent after the samples
+        for (unsigned h=0;h<NUM_OUT;h++){
+            connect<window<(N_POINT/NUM_OUT+BFP_TRAILER)*sizeof(T)> >(fft_kernel.out[h],out[h]);
+        }
+
+        source(fft_kernel)="fft_kernel.cpp";
+        // initialization_function(fft_kernel) = "fft_1k_init";
+
+        runtime<ratio>(fft_kernel)=0.8;
+
+        // ring of eight tiles around the stage-two kernel at (col,1); the
+        // wider types and a multi-kernel stage two need more data memory than
+        // the ring has, the mapper places them
+        if (NUM_TILES==8 && NUM_OUT==1){
+            if (id==6) location<kernel>(fft_kernel)=tile(col-1,2);
+            if (id==1) location<kernel>(fft_kernel)=tile(col,2);
+            if (id==2) location<kernel>(fft_kernel)=tile(col+1,2);
+            if (id==3) location<kernel>(fft_kernel)=tile(col-1,1);
+            if (id==4) location<kernel>(fft_kernel)=tile(col+1,1);
+            if (id==5) location<kernel>(fft_kernel)=tile(col-1,0);
+            if (id==0) location<kernel>(fft_kernel)=tile(col,0);
+            if (id==7) location<kernel>(fft_kernel)=tile(col+1,0);
+        }
+    }
+};
+
+// fft_tile_graph<0> ... fft_tile_graph<id>, one level per tile id.
+// Output h of tile t is out[t*OUT+h].
+template<unsigned NUM_TILES, typename T, unsigned OUT=TILE_OUT<NUM_TILES, T>, unsigned id=NUM_TILES-1>
+class fft_tile_array : public fft_tile_array<NUM_TILES, T, OUT, id-1> {
+private:
+    fft_tile_graph<id, NUM_TILES, T, OUT> fft;
+public:
+    fft_tile_array(int col=ring_col(0)) : fft_tile_array<NUM_TILES, T, OUT, id-1>(col), fft(col){
+        connect<>(this->in[id],fft.in);
+        connect<parameter>(this->window_type,fft.window_type);
+        connect<parameter>(this->direction,fft.direction);
+        connect<parameter>(this->out_shift,fft.out_shift);
+        connect<parameter>(this->band_lo,fft.band_lo);
+        connect<parameter>(this->band_hi,fft.band_hi);
+        for (unsigned h=0;h<fft.NUM_OUT;h++){
+            connect<>(fft.out[h],this->out[id*fft.NUM_OUT+h]);
+        }
+    }
+};
+
+template<unsigned NUM_TILES, typename T, unsigned OUT>
+class fft_tile_array<NUM_TILES, T, OUT, 0> : public graph {
+private:
+    fft_tile_graph<0, NUM_TILES, T, OUT> fft;
+public:
+    port<input> in[NUM_TILES];
+    port<output> out[NUM_TILES*OUT];
+    port<input> window_type; // shared by every tile
+    port<input> direction;
+    port<input> out_shift;
+    port<input> band_lo;
+    port<input> band_hi;
+
+    fft_tile_array(int col=ring_col(0)) : fft(col){
+        connect<>(in[0],fft.in);
+        connect<parameter>(window_type,fft.window_type);
+        connect<parameter>(direction,fft.direction);
+        connect<parameter>(out_shift,fft.out_shift);
+        connect<parameter>(band_lo,fft.band_lo);
+        connect<parameter>(band_hi,fft.band_hi);
+        for (unsigned h=0;h<fft.NUM_OUT;h++){
+            connect<>(fft.out[h],out[h]);
+        }
+    }
+};
+
+// output_mode and average, the run-time parameters only the 8-point stage
+// two has (fft_stage2)
+template<unsigned NUM_TILES>
+class spectrum_ports : public graph {};
+
+template<>
+class spectrum_ports<MAX_TILES> : public graph {
+public:
+    port<input> output_mode; // FFT_OUT_COMPLEX/POWER/DB run-time parameter
+    port<input> average;     // frames per output, FFT_WELCH builds
+};
+
+// Input t*SPLIT+h is slice h of tile t, kernel h of a split stage two takes
+// slice h of every tile. Output q*SPLIT+h is row q of kernel h (8 tiles:
+// stream q of kernel h, carrying rows q*8/STREAMS ...), so the outputs in
+// index order hold the rows in order.
+template<unsigned NUM_TILES, typename T>
+class stage2_graph :public spectrum_ports<NUM_TILES>{
+private:
+    static constexpr unsigned SPLIT=S2_SLICES<NUM_TILES, T>;
+    // the 8-point stage streams its result, the smaller ones fit a window per row
+    static constexpr unsigned ROWS=NUM_TILES==8?S2_STREAMS<T>:NUM_TILES;
+
+    kernel stage2_kernel[SPLIT];
+
+    // the 8-point kernel of slice h knows its bins (band_lo/band_hi)
+    template<unsigned h=SPLIT-1>
+    void create_stage2(){
+        if constexpr (NUM_TILES==8 && ROWS==2) stage2_kernel[h]=kernel::create_object<fft_stage2_dual<h, T>>();
+        else if constexpr (NUM_TILES==8) stage2_kernel[h]=kernel::create_object<fft_stage2<h, T>>();
+        else if constexpr (NUM_TILES==4) stage2_kernel[h]=kernel::create(fft_stage2_4<T>);
+        else stage2_kernel[h]=kernel::create(fft_stage2_2<T>);
+        if constexpr (h>0) create_stage2<h-1>();
+    }
+public:
+    static constexpr unsigned NUM_OUT=ROWS*SPLIT;
+
+    port<input> in[NUM_TILES*SPLIT];
+    port<output> out[NUM_OUT];
+    port<input> direction; // FFT_FORWARD/INVERSE run-time parameter
+    port<input> out_shift; // right shift of the result
+    port<input> band_lo;   // bins band_lo ... band_hi-1 only, 8 tiles
+    port<input> band_hi;
+
+    stage2_graph(int col=ring_col(0)){
+        create_stage2();
+        for (unsigned h=0;h<SPLIT;h++){
+            for (unsigned i=0;i<NUM_TILES;i++){
+                connect<window<(N_POINT/SPLIT+BFP_TRAILER)*sizeof(T)> >(in[i*SPLIT+h],stage2_kernel[h].in[i]);
+            }
+            connect<parameter>(direction,async(stage2_kernel[h].in[NUM_TILES]));
+            connect<parameter>(out_shift,async(stage2_kernel[h].in[NUM_TILES+1]));
+            if constexpr (NUM_TILES==8){
+                connect<parameter>(this->output_mode,async(stage2_kernel[h].in[NUM_TILES+2]));
+                connect<parameter>(this->average,async(stage2_kernel[h].in[NUM_TILES+3]));
+                connect<parameter>(band_lo,async(stage2_kernel[h].in[NUM_TILES+4]));
+                connect<parameter>(band_hi,async(stage2_kernel[h].in[NUM_TILES+5]));
+            }
+            if constexpr (NUM_TILES==8){
+                for (unsigned q=0;q<ROWS;q++){
+                    connect<stream>(stage2_kernel[h].out[q],out[q*SPLIT+h]);
+                }
+            } else {
+                for (unsigned q=0;q<ROWS;q++){
+                    connect<window<(N_POINT/SPLIT+BFP_TRAILER)*sizeof(T)> >(stage2_kernel[h].out[q],out[q*SPLIT+h]);
+                }
+            }
+
+            source(stage2_kernel[h])="stage2_kernel.cpp";
+
+            runtime<ratio>(stage2_kernel[h])=0.8;
+
+            if (NUM_TILES==8 && SPLIT==1) location<kernel>(stage2_kernel[h])=tile(col,1);
+        }
+    }
+};
+
+// a single tile needs no second stage
+template<typename T>
+class stage2_graph<1, T> :public graph{
+public:
+    static constexpr unsigned NUM_OUT=1;
+
+    stage2_graph(int col=ring_col(0)){}
+};
+
+// N-point FFT: NUM_TILES stage-one tiles of N_POINT points each feed a
+// NUM_TILES-point stage two. Tile i reads the stride-NUM_TILES subsequence
+// x[NUM_TILES*m+i] from PLIO DataInFFT<i>; results leave through DataOutFFT<q>,
+// whose concatenation in q order is the whole output frame. Instance inst of
+// a replicated design numbers its PLIOs from inst*NUM_TILES and inst*NUM_OUT
+// and sits on its own placement ring; instance 0 is the single-graph design.
+// The window_type port selects the window applied to every input frame
+// (WINDOW_NONE/HANN/BLACKMAN); direction selects FFT_FORWARD or FFT_INVERSE
+// (N * IDFT, by conjugation in the first and the last stage) and out_shift
+// scales the result by 2^-out_shift (13 for the 1/N of an 8K inverse), in the
+// exponent with FFT_BFP. The 8-tile graph adds output_mode, the complex bins
+// or their power or dB, and average, the frames whose mean power one output
+// carries (FFT_WELCH); averaged frames leave nothing in between. band_lo and
+// band_hi narrow the 8-tile transform to the bins band_lo ... band_hi-1
+// (complex output, multiples of 4): the stage-one tiles leave out the
+// last-pass butterflies no bin of the band needs and stage two computes and
+// streams the band alone, row by row; 0 and N is the whole spectrum in the
+// usual order, the other graphs ignore them. All RTPs must be written once
+// before the first frame; a frame in flight while direction, out_shift,
+// output_mode or the band change may mix them.
+template<unsigned N, unsigned NUM_TILES=N/N_POINT, typename T=cint16>
+class fft_graph: public spectrum_ports<NUM_TILES>{
+    static_assert(std::is_same<T, cint16>::value || std::is_same<T, cint32>::value || std::is_same<T, cfloat>::value,
+                  "kernels exist for cint16, cint32 and cfloat samples");
+    static_assert(BFP_TRAILER==0 || std::is_same<T, cint16>::value, "block floating point is a cint16 mode");
+    static_assert(N==NUM_TILES*N_POINT, "every stage-one tile computes N_POINT points");
+    static_assert(NUM_TILES==1 || NUM_TILES==2 || NUM_TILES==4 || NUM_TILES==MAX_TILES,
+                  "stage two is a 1/2/4/8-point DFT; wider ones do not fit the tile memory");
+private:
+    fft_tile_array<NUM_TILES, T> tiles;
+    stage2_graph<NUM_TILES, T> s2;
+public:
+    static constexpr unsigned NUM_OUT=stage2_graph<NUM_TILES, T>::NUM_OUT;
+    static constexpr unsigned TILES=NUM_TILES;
+
+    input_plio in[NUM_TILES];
+    output_plio out[NUM_OUT];
+    port<input> window_type;
+    port<input> direction;
+    port<input> out_shift;
+    port<input> band_lo;
+    port<input> band_hi;
+
+    fft_graph(unsigned inst=0) : tiles(ring_col(inst)), s2(ring_col(inst)){
+        connect<parameter>(window_type,tiles.window_type);
+        connect<parameter>(direction,tiles.direction);
+        connect<parameter>(out_shift,tiles.out_shift);
+        connect<parameter>(band_lo,tiles.band_lo);
+        connect<parameter>(band_hi,tiles.band_hi);
+        if constexpr (NUM_TILES>1){
+            connect<parameter>(direction,s2.direction);
+            connect<parameter>(out_shift,s2.out_shift);
+        }
+        if constexpr (NUM_TILES==MAX_TILES){
+            connect<parameter>(this->output_mode,s2.output_mode);
+            connect<parameter>(this->average,s2.average);
+            connect<parameter>(band_lo,s2.band_lo);
+            connect<parameter>(band_hi,s2.band_hi);
+        }
+        // every instance simulates on the same input vectors
+        for (unsigned i=0;i<NUM_TILES;i++){
+            std::string name="DataInFFT"+std::to_string(inst*NUM_TILES+i);
+            in[i]=input_plio::create(name,plio_128_bits,"data/DataInFFT"+std::to_string(i)+".txt");
+            connect<>(in[i].out[0],tiles.in[i]);
+        }
+        for (unsigned q=0;q<NUM_OUT;q++){
+            std::string name="DataOutFFT"+std::to_string(inst*NUM_OUT+q);
+            out[q]=output_plio::create(name,plio_128_bits,"data/"+name+".txt");
+        }
+
+        if constexpr (NUM_TILES==1){
+            connect<>(tiles.out[0],out[0].in[0]);
+        } else {
+            for (unsigned i=0;i<NUM_TILES*TILE_OUT<NUM_TILES, T>;i++){
+                connect<>(tiles.out[i],s2.in[i]);
+            }
+            for (unsigned q=0;q<NUM_OUT;q++){
+                connect<>(s2.out[q],out[q].in[0]);
+            }
+        }
+    }
+};
+
+// Overlap-save fast convolution with a run-time filter: the 8K forward
+// transform, the product with the filter spectrum H and the unscaled 8K
+// inverse transform, all on the array. The stage-one tiles hand CONV_SLICES
+// slices of their bins to as many conv_stage2 kernels (forward 8-point stage,
+// product, inverse 8-point stage); inverse tile t turns what they hand it
+// into y[8m+t], m = 0 ... N_POINT-1, and sends it out through DataOutFFT<t>,
+// so input and output frames share the tile-major layout. A frame y is N times
+// the circular convolution of the input with IDFT(H / 2^filter_shift);
+// overlap-save keeps its samples from the filter length - 1 on.
+// filter[h]: the bins of slice h, see conv_stage2; filter_shift: the product
+// shift (the fixed-point types); window_type, direction and out_shift must
+// stay WINDOW_NONE, FFT_FORWARD and 0, band_lo and band_hi 0 and N.
+template<typename T=cint16>
+class fft_conv_graph: public graph{
+    static_assert(BFP_TRAILER==0 || std::is_same<T, cint16>::value, "block floating point is a cint16 mode");
+private:
+    static constexpr unsigned NUM_TILES=MAX_TILES;
+    fft_tile_array<NUM_TILES, T, CONV_SLICES> tiles;
+    kernel conv_kernel[CONV_SLICES];
+    kernel inverse_kernel[NUM_TILES];
+
+    template<unsigned h=CONV_SLICES-1>
+    void create_conv(){
+        conv_kernel[h]=kernel::create(conv_stage2<h, T>);
+        if constexpr (h>0) create_conv<h-1>();
+    }
+    template<unsigned t=NUM_TILES-1>
+    void create_inverse(){
+        inverse_kernel[t]=kernel::create(radix2_dit_inverse4<t, T>);
+        if constexpr (t>0) create_inverse<t-1>();
+    }
+public:
+    static constexpr unsigned NUM_OUT=NUM_TILES;
+
+    input_plio in[NUM_TILES];
+    output_plio out[NUM_OUT];
+    port<input> window_type;
+    port<input> direction;
+    port<input> out_shift;
+    port<input> band_lo;
+    port<input> band_hi;
+    port<input> filter[CONV_SLICES];
+    port<input> filter_shift;
+
+    fft_conv_graph(){
+        create_conv();
+        create_inverse();
+        connect<parameter>(window_type,tiles.window_type);
+        connect<parameter>(direction,tiles.direction);
+        connect<parameter>(out_shift,tiles.out_shift);
+        connect<parameter>(band_lo,tiles.band_lo);
+        connect<parameter>(band_hi,tiles.band_hi);
+        for (unsigned i=0;i<NUM_TILES;i++){
+            std::string name="DataInFFT"+std::to_string(i);
+            in[i]=input_plio::create(name,plio_128_bits,"data/"+name+".txt");
+            connect<>(in[i].out[0],tiles.in[i]);
+        }
+        for (unsigned h=0;h<CONV_SLICES;h++){
+            for (unsigned i=0;i<NUM_TILES;i++){
+                connect<window<(CONV_BINS+BFP_TRAILER)*sizeof(T)> >(tiles.out[i*CONV_SLICES+h],conv_kernel[h].in[i]);
+                connect<window<(CONV_BINS+BFP_TRAILER)*sizeof(T)> >(conv_kernel[h].out[i],inverse_kernel[i].in[h]);
+            }
+            connect<parameter>(filter[h],async(conv_kernel[h].in[NUM_TILES]));
+            connect<parameter>(filter_shift,async(conv_kernel[h].in[NUM_TILES+1]));
+            source(conv_kernel[h])="stage2_kernel.cpp";
+            runtime<ratio>(conv_kernel[h])=0.8;
+        }
+        for (unsigned t=0;t<NUM_TILES;t++){
+            std::string name="DataOutFFT"+std::to_string(t);
+            out[t]=output_plio::create(name,plio_128_bits,"data/"+name+".txt");
+            connect<window<(N_POINT+BFP_TRAILER)*sizeof(T)> >(inverse_kernel[t].out[0],out[t].in[0]);
+            source(inverse_kernel[t])="fft_kernel.cpp";
+            runtime<ratio>(inverse_kernel[t])=0.8;
+        }
+    }
+};
+
+// Eight independent N_POINT transforms: the stage-one tiles of the 8K graph,
+// each a standalone 1K FFT (tile 0 of a single-tile transform, no cross
+// twiddles) on its own channel, and no stage two. Tile t reads channel t from
+// DataInFFT<t> and sends its spectrum, with its own BFP trailer, through
+// DataOutFFT<t>; instance inst numbers its PLIOs from inst*MAX_TILES. The
+// window_type, direction and out_shift ports act as in the 1K graph, band_lo
+// and band_hi must be written but are ignored.
+template<typename T=cint16>
+class fft_multi_graph: public graph{
+    static_assert(BFP_TRAILER==0 || std::is_same<T, cint16>::value, "block floating point is a cint16 mode");
+private:
+    fft_tile_graph<0, 1, T> tiles[MAX_TILES];
+public:
+    static constexpr unsigned NUM_OUT=MAX_TILES;
+    static constexpr unsigned TILES=1; // tiles per transform
+
+    input_plio in[MAX_TILES];
+    output_plio out[NUM_OUT];
+    port<input> window_type;
+    port<input> direction;
+    port<input> out_shift;
+    port<input> band_lo;
+    port<input> band_hi;
+
+    fft_multi_graph(unsigned inst=0){
+        for (unsigned t=0;t<MAX_TILES;t++){
+            connect<parameter>(window_type,tiles[t].window_type);
+            connect<parameter>(direction,tiles[t].direction);
+            connect<parameter>(out_shift,tiles[t].out_shift);
+            connect<parameter>(band_lo,tiles[t].band_lo);
+            connect<parameter>(band_hi,tiles[t].band_hi);
+            // every instance simulates on the same input vectors
+            std::string name="DataInFFT"+std::to_string(inst*MAX_TILES+t);
+            in[t]=input_plio::create(name,plio_128_bits,"data/DataInFFT"+std::to_string(t)+".txt");
+            connect<>(in[t].out[0],tiles[t].in);
+            name="DataOutFFT"+std::to_string(inst*NUM_OUT+t);
+            out[t]=output_plio::create(name,plio_128_bits,"data/"+name+".txt");
+            connect<>(tiles[t].out[0],out[t].in[0]);
+        }
+    }
+};
+
+// COPIES independent instances of graph G, G(0) ... G(COPIES-1). Each one
+// has its own PLIOs and data movers, so the host spreads frames over them;
+// the window_type, direction, out_shift and band ports (and output_mode and
+// average of the 8K graph) are shared by all of them.
+template<typename G, unsigned COPIES>
+class fft_instances : public fft_instances<G, COPIES-1> {
+    static_assert(COPIES<=MAX_INSTANCES, "more instances than placement rings");
+private:
+    G g;
+public:
+    fft_instances() : g(COPIES-1){
+        connect<parameter>(this->window_type,g.window_type);
+        connect<parameter>(this->direction,g.direction);
+        connect<parameter>(this->out_shift,g.out_shift);
+        connect<parameter>(this->band_lo,g.band_lo);
+        connect<parameter>(this->band_hi,g.band_hi);
+        if constexpr (G::TILES==MAX_TILES){
+            connect<parameter>(this->output_mode,g.output_mode);
+            connect<parameter>(this->average,g.average);
+        }
+    }
+};
+
+template<typename G>
+class fft_instances<G, 0> : public spectrum_ports<G::TILES> {
+public:
+    port<input> window_type;
+    port<input> direction;
+    port<input> out_shift;
+    port<input> band_lo;
+    port<input> band_hi;
+};
@@ -0,0 +1,378 @@
+#include "fft_kernel.hpp"
+#include "profile.hpp"
+#include <cstdio>
+#include <aie_api/utils.hpp>
+#include <adf.h>
+
+// void fft_1k_init(){
+//     set_rounding(rounding_mode::symmetric_inf);
+//     set_saturation(saturation_mode::saturate);
+// }
+
+// The passes work on K segments of the 1K block through y[0] ... y[K-1]
+// (K = 2: the two halves): every butterfly before the last one stays inside
+// a segment or a pair of neighbouring ones, and the last one writes the lower
+// and upper half of the result. A tile whose output feeds a split stage two
+// (S2_SLICES) hands the segments to separate windows.
+// s: block-floating-point shift of a pass, each pass returns the peak of its output
+
+// The bit reversal is fused into the 8-point DFT: block b gathers its
+// inputs x[bitrev(b)+N_POINT/MAX_VEC_LEN*i] straight from the input window
+// and writes the block in order, so no separate shuffle pass is needed.
+// WIN: the gathered inputs are first multiplied by the window w (in gather
+// order, see win<>) in the accumulator and keep g fractional bits into the
+// DFT, which drops them with its own rounding. g fills the headroom of the
+// input peak (bfp::guard), with FFT_BFP or without, so a windowed sample is
+// rounded to the precision of the input's full range, not to an integer.
+// INV: the input comes as the K segments x[0] ... x[K-1] and input j is read
+// from -j mod N_POINT; the forward transform of the reversed input is the
+// inverse one. Otherwise x[0] holds the whole input.
+template<bool WIN, bool INV, unsigned K, typename T>
+unsigned dft_8(T * const *x, T * const *y, const real_t<T> *w, unsigned g, unsigned s)
+{
+    constexpr unsigned STRIDE = N_POINT / MAX_VEC_LEN;
+    constexpr unsigned SEG = N_POINT / K;
+    bfp::peak<MAX_VEC_LEN, T> pk;
+    for (unsigned h = 0; h < K; h++)
+    {
+        auto iterout=begin_vector<MAX_VEC_LEN>(y[h]);
+        auto iterwin=begin_vector<MAX_VEC_LEN>(WIN ? w + h * N_POINT / K : w);
+        for (unsigned b=h*STRIDE/K;b<(h+1)*STRIDE/K;b++)
+        {
+            const T *p=x[0]+bitrev<STRIDE>.data[b];
+            auto iter=begin_vector<MAX_VEC_LEN>(mat_omg<MAX_VEC_LEN, MAT_OMG_SHIFT, coeff_t<T>>.data);
+            constexpr unsigned STEP = WIN || INV ? 1 : STRIDE;
+            alignas(32) T xw[MAX_VEC_LEN];
+            if constexpr (WIN)
+            {
+                vector<T,MAX_VEC_LEN> v;
+                for (unsigned i=0;i<MAX_VEC_LEN;i++) v.set(p[i*STRIDE],i);
+                store_v(xw, srs<T>(mul(v,*iterwin++),WIN_SHIFT-g));
+                p=xw;
+            }
+            else if constexpr (INV)
+            {
+                for (unsigned i=0;i<MAX_VEC_LEN;i++){
+                    unsigned j=(N_POINT-bitrev<STRIDE>.data[b]-i*STRIDE)%N_POINT;
+                    xw[i]=x[j/SEG][j%SEG];
+                }
+                p=xw;
+            }
+            auto m=mul(*iter++,p[0]);
+
+            for (unsigned i=1;i<MAX_VEC_LEN;i++){
+                m=mac(m,*iter++,p[i*STEP]);
+            }
+            vector<T,MAX_VEC_LEN> v=srs<T>(m,MAT_OMG_SHIFT+g+s);
+            *iterout++=v;
+            pk.update(v);
+        }
+    }
+    return pk.value();
+}
+
+// Two radix-2 passes (lengths l and 2l) fused as one radix-2^2 pass: each
+// block of 2l is read and written once, the intermediate stays in registers.
+// The rounding after every twiddle multiply matches the separate passes.
+// Block b of 2l lies in one segment, or its halves lie in two neighbouring
+// ones when 2l is longer than a segment.
+template<unsigned l, unsigned K, typename T>
+unsigned butterfly_r4(T * const *x, T * const *y, unsigned s)
+{
+    constexpr unsigned m = l >> 1;
+    constexpr unsigned V = m < VEC_LEN<T> ? m : VEC_LEN<T>;
+    constexpr unsigned SEG = N_POINT / K;
+    static_assert(l <= SEG, "half a block must fit a segment");
+    const coeff_t<T> *w = omg<l, OMG_SHIFT, coeff_t<T>>.data;
+    const coeff_t<T> *w2 = omg<2 * l, OMG_SHIFT, coeff_t<T>>.data;
+    bfp::peak<V, T> pk;
+    for (unsigned b = 0; b < N_POINT / (2 * l); b++)
+    {
+        const unsigned lo = 2 * l * b, hi = lo + l;
+        T *p = x[lo / SEG] + lo % SEG, *p_hi = x[hi / SEG] + hi % SEG;
+        T *p_out = y[lo / SEG] + lo % SEG, *p_out_hi = y[hi / SEG] + hi % SEG;
+        auto iteromg=begin_vector<V>(w);
+        auto iteromg2_lo=begin_vector<V>(w2);
+        auto iteromg2_hi=begin_vector<V>(w2 + m);
+        for (unsigned i = 0; i < m; i += V)
+        {
+            vector<T, V> v_0 = bfp::downshift(load_v<V>(p + i), s);
+            vector<T, V> v_1 = load_v<V>(p + i + m);
+            vector<T, V> v_2 = bfp::downshift(load_v<V>(p_hi + i), s);
+            vector<T, V> v_3 = load_v<V>(p_hi + i + m);
+
+            // length l
+            vector<coeff_t<T>, V> v_omg = *iteromg++;
+            vector<T, V> v_t = srs<T>(mul(v_omg, v_1), OMG_SHIFT + s);
+            v_1 = sub(v_0, v_t);
+            v_0 = add(v_0, v_t);
+            v_t = srs<T>(mul(v_omg, v_3), OMG_SHIFT + s);
+            v_3 = sub(v_2, v_t);
+            v_2 = add(v_2, v_t);
+
+            // length 2l
+            vector<T, V> v_t0 = srs<T>(mul(*iteromg2_lo++, v_2), OMG_SHIFT);
+            vector<T, V> v_t1 = srs<T>(mul(*iteromg2_hi++, v_3), OMG_SHIFT);
+            v_2 = sub(v_0, v_t0);
+            v_0 = add(v_0, v_t0);
+            v_3 = sub(v_1, v_t1);
+            v_1 = add(v_1, v_t1);
+            store_v(p_out + i, v_0);
+            store_v(p_out + i + m, v_1);
+            store_v(p_out_hi + i, v_2);
+            store_v(p_out_hi + i + m, v_3);
+            pk.update(v_0);
+            pk.update(v_1);
+            pk.update(v_2);
+            pk.update(v_3);
+        }
+    }
+    return pk.value();
+}
+
+// V butterflies of the last pass from x0 and x1 (times the twiddles w) into
+// y0 and y1, TF: times the cross twiddles t0 and t1
+template<bool TF, unsigned V, typename T>
+static inline void butterfly_2(const T *x0, const T *x1, T *y0, T *y1, const coeff_t<T> *w,
+                               const coeff_t<T> *t0, const coeff_t<T> *t1, unsigned s, bfp::peak<V, T> &pk)
+{
+    auto acc_t = mul(load_v<V>(w), load_v<V>(x1));
+    vector<T, V> v_t = srs<T>(acc_t, OMG_SHIFT + s);
+    vector<T, V> v_0 = bfp::downshift(load_v<V>(x0), s);
+    vector<T, V> v_1 = sub(v_0, v_t);
+    v_0 = add(v_0, v_t);
+    if constexpr (TF)
+    {
+        v_1 = srs<T>(mul(v_1, load_v<V>(t1)), TF_SHIFT);
+        v_0 = srs<T>(mul(v_0, load_v<V>(t0)), TF_SHIFT);
+    }
+    store_v(y0, v_0);
+    store_v(y1, v_1);
+    pk.update(v_0);
+    pk.update(v_1);
+}
+
+// Last radix-2 pass, x[k] and x[k+K/2] are the two inputs of every butterfly.
+// TF: also apply the cross twiddles tf (tile id != 0 of a multi-tile transform).
+// Butterfly b writes bins b and b + N_POINT/2; only the count vectors of
+// butterflies from vector first on are computed, circularly (a band of the
+// spectrum, see fft_tile), all of them by default.
+template<bool TF, unsigned K, typename T>
+unsigned butterfly_1024(T * const *x, T * const *y, const coeff_t<T> *tf, unsigned s,
+                        unsigned first = 0, unsigned count = N_POINT / 2 / VEC_LEN<T>)
+{
+    constexpr unsigned V = VEC_LEN<T>;
+    constexpr unsigned SEG = N_POINT / K;
+    constexpr unsigned HALF = N_POINT / 2 / V;
+    const coeff_t<T> *w = omg<1024, OMG_SHIFT, coeff_t<T>>.data;
+    bfp::peak<V, T> pk;
+    if (count == HALF)
+    {
+        for (unsigned k = 0; k < K / 2; k++)
+            for (unsigned i = 0; i < SEG; i += V)
+            {
+                unsigned b = k * SEG + i;
+                butterfly_2<TF>(x[k] + i, x[k + K / 2] + i, y[k] + i, y[k + K / 2] + i, w + b,
+                                TF ? tf + b : tf, TF ? tf + N_POINT / 2 + b : tf, s, pk);
+            }
+        return pk.value();
+    }
+    for (unsigned j = 0; j < count; j++)
+    {
+        unsigned b = (first + j) % HALF * V, k = b / SEG, i = b % SEG;
+        butterfly_2<TF>(x[k] + i, x[k + K / 2] + i, y[k] + i, y[k + K / 2] + i, w + b,
+                        TF ? tf + b : tf, TF ? tf + N_POINT / 2 + b : tf, s, pk);
+    }
+    return pk.value();
+}
+
+// in-place conjugate of LEN samples
+template<unsigned LEN, typename T>
+static inline void conjugate(T *x)
+{
+    auto iter=begin_vector<VEC_LEN<T>>(x);
+    for (unsigned i = 0; i < LEN / VEC_LEN<T>; i++, iter++)
+        *iter = conj(*iter);
+}
+
+// x >> d in place, LEN samples
+template<unsigned LEN, typename T>
+static inline void downshift_block(T *x, unsigned d)
+{
+    auto iter=begin_vector<VEC_LEN<T>>(x);
+    for (unsigned i = 0; i < LEN / VEC_LEN<T>; i++, iter++)
+        *iter = bfp::downshift(*iter, d);
+}
+
+// x: the input frame, or (INV) its K segments; y: K segments, W output
+// windows (1 or K), each ending with the BFP trailer
+// window: WINDOW_NONE/HANN/BLACKMAN applied to the input frame
+// direction: FFT_FORWARD/INVERSE; out_shift: right shift of the result, taken
+// only by the last stage (a single tile, otherwise stage two)
+// band_lo, band_hi: the bins of the 8K spectrum stage two computes (8 tiles),
+// the last pass leaves out the butterflies none of them needs
+// INV: inverse transform of K segments that each carry their exponent in a
+// trailer (the slices of separate conv_stage2 kernels), brought to the
+// largest one first; no window and no cross twiddles, id only names the tile
+template<unsigned id, unsigned NUM_TILES, unsigned K, unsigned W, bool INV, typename T>
+static inline void fft_tile(T * const *x, T * const *y, int window, int direction, int out_shift,
+                            int band_lo, int band_hi)
+{
+    // ----------------------------------dit----------------------------------
+
+    static unsigned calls;
+    prof::stamps<6> st;
+
+    T * xh[K];
+    for (unsigned k = 0; k < K; k++) xh[k] = INV ? x[k] : x[0] + k * N_POINT / K;
+
+    // the input window is scratch of the passes anyway
+    if (direction == FFT_INVERSE)
+        for (unsigned k = 0; k < K; k++) conjugate<N_POINT / K>(xh[k]);
+
+    // the segments of INV come at their own exponents: bring them to the
+    // largest before the scan, as stage two aligns the tiles
+    int e=0;
+    if constexpr (INV)
+    {
+        unsigned d[K], p;
+        e=bfp::align<K, N_POINT / K>(x, d, p);
+        for (unsigned k = 0; k < K; k++)
+            if (d[k]) downshift_block<N_POINT / K>(xh[k], d[k]);
+    }
+    unsigned peak=0;
+    for (unsigned k = 0; k < K; k++){
+        unsigned pk=bfp::scan<N_POINT / K>(xh[k]);
+        if (pk > peak) peak = pk;
+    }
+    unsigned s=bfp::shift(peak,bfp::dft_growth<MAX_VEC_LEN>);
+    e+=s;
+    // the windowed samples carry the headroom of the input as fractional
+    // bits; without FFT_BFP the scan above measured nothing
+    unsigned g=0;
+    if (!INV && window != WINDOW_NONE)
+    {
+        unsigned wp=peak;
+#ifndef FFT_BFP
+        for (unsigned k = 0; k < K; k++){
+            unsigned pk=bfp::window_scan<N_POINT / K>(xh[k]);
+            if (pk > wp) wp = pk;
+        }
+#endif
+        g=bfp::guard<T>(wp);
+    }
+    st.mark("scan");
+    constexpr unsigned N = NUM_TILES * N_POINT;
+    if constexpr (INV)
+        peak=dft_8<false, true, K>(xh, y, (const real_t<T> *)nullptr, 0, s);
+    else if (window == WINDOW_HANN)
+        peak=dft_8<true, false, K>(x, y, win<N, id, WINDOW_HANN, WIN_SHIFT, real_t<T>>.data, g, s);
+    else if (window == WINDOW_BLACKMAN)
+        peak=dft_8<true, false, K>(x, y, win<N, id, WINDOW_BLACKMAN, WIN_SHIFT, real_t<T>>.data, g, s);
+    else
+        peak=dft_8<false, false, K>(x, y, (const real_t<T> *)nullptr, 0, s);
+    st.mark("dft8");
+
+    // auto iterin=begin_vector<32>(y);
+    // auto iterout=begin_vector<4>(x);
+    // for (unsigned i=0;i<32;i++){
+    //     auto itermat=begin_vector<8>(mat_omg_8);
+    //     for (unsigned j=0;j<8;j++){
+    //         auto res=sliding_mul_ops<4,8,1,4,1,cint16,cint16,cacc48>::mul(*itermat++,0,*iterin,0);
+    //         *iterout++=res.to_vector<cint16>(MAT_OMG_SHIFT);
+    //     }
+    //     iterin++;
+    // }
+
+    s=bfp::shift(peak,bfp::R4_GROWTH); e+=s;
+    peak=butterfly_r4<16, K>(y, xh, s);
+    st.mark("r4_16");
+    s=bfp::shift(peak,bfp::R4_GROWTH); e+=s;
+    peak=butterfly_r4<64, K>(xh, y, s);
+    st.mark("r4_64");
+    s=bfp::shift(peak,bfp::R4_GROWTH); e+=s;
+    peak=butterfly_r4<256, K>(y, xh, s);
+    st.mark("r4_256");
+
+    // Stage two reads bin r of the tile for the bins N_POINT*q + r of the band;
+    // a band narrower than N_POINT/2 needs the butterflies from band_lo mod
+    // N_POINT/2 on, as many as it has bins (rounded out to whole vectors)
+    constexpr unsigned V = VEC_LEN<T>, HALF = N_POINT / 2 / V;
+    unsigned first = 0, count = HALF;
+    if constexpr (NUM_TILES == MAX_TILES && !INV)
+        if (band_hi > band_lo && band_hi - band_lo < N_POINT / 2)
+        {
+            unsigned b = band_lo % (N_POINT / 2);
+            first = b / V;
+            count = (b + band_hi - band_lo + V - 1) / V - first;
+            if (count > HALF) count = HALF;
+        }
+
+    // tile id of an N-point transform also applies the cross twiddles W_N^(id*k)
+    s=bfp::shift(peak,bfp::R2_GROWTH); e+=s;
+    if constexpr (id == 0 || INV)
+        peak=butterfly_1024<false, K>(xh, y, (const coeff_t<T> *)nullptr, s, first, count);
+    else
+        peak=butterfly_1024<true, K>(xh, y, tf<NUM_TILES * N_POINT, id, TF_SHIFT, coeff_t<T>>.data, s, first, count);
+
+    // a single tile is the last stage of its transform
+    if constexpr (NUM_TILES == 1 && !INV)
+    {
+        unsigned o = bfp::scale(out_shift, e);
+        bool inverse = direction == FFT_INVERSE;
+        if (o || inverse)
+            for (unsigned k = 0; k < K; k++)
+            {
+                auto iter=begin_vector<VEC_LEN<T>>(y[k]);
+                for (unsigned i = 0; i < N_POINT / K / VEC_LEN<T>; i++, iter++)
+                    *iter = conj_if(downscale(*iter, o), inverse);
+            }
+    }
+
+    // exponent and peak of the block for stage two (FFT_BFP only)
+    for (unsigned w = 0; w < W; w++)
+        bfp::write_trailer(y[(w + 1) * K / W - 1] + N_POINT / K, e, peak);
+    st.mark("r2_1024");
+
+    // FFT_PROFILE only
+    st.report(INV ? "radix2_dit_inverse4" : "radix2_dit", id, calls);
+}
+
+template<unsigned id, unsigned NUM_TILES, typename T>
+void radix2_dit(input_window<T> *x_in, output_window<T> *y_out, int window, int direction, int out_shift,
+                int band_lo, int band_hi)
+{
+    T * const x[1] = {(T *)x_in->ptr};
+    T *y = (T *)y_out->ptr;
+    T * const yh[2] = {y, y + N_POINT / 2};
+    fft_tile<id, NUM_TILES, 2, 1, false>(x, yh, window, direction, out_shift, band_lo, band_hi);
+}
+
+template<unsigned id, unsigned NUM_TILES, typename T>
+void radix2_dit_split(input_window<T> *x_in, output_window<T> *y_lo, output_window<T> *y_hi, int window,
+                      int direction, int out_shift, int band_lo, int band_hi)
+{
+    T * const x[1] = {(T *)x_in->ptr};
+    T * const yh[2] = {(T *)y_lo->ptr, (T *)y_hi->ptr};
+    fft_tile<id, NUM_TILES, 2, 2, false>(x, yh, window, direction, out_shift, band_lo, band_hi);
+}
+
+template<unsigned id, unsigned NUM_TILES, typename T>
+void radix2_dit_split4(input_window<T> *x_in, output_window<T> *y_out0, output_window<T> *y_out1,
+                       output_window<T> *y_out2, output_window<T> *y_out3, int window,
+                       int direction, int out_shift, int band_lo, int band_hi)
+{
+    T * const x[1] = {(T *)x_in->ptr};
+    T * const yq[4] = {(T *)y_out0->ptr, (T *)y_out1->ptr, (T *)y_out2->ptr, (T *)y_out3->ptr};
+    fft_tile<id, NUM_TILES, 4, 4, false>(x, yq, window, direction, out_shift, band_lo, band_hi);
+}
+
+template<unsigned id, typename T>
+void radix2_dit_inverse4(input_window<T> *x_in0, input_window<T> *x_in1, input_window<T> *x_in2,
+                         input_window<T> *x_in3, output_window<T> *y_out)
+{
+    T * const x[4] = {(T *)x_in0->ptr, (T *)x_in1->ptr, (T *)x_in2->ptr, (T *)x_in3->ptr};
+    T *y = (T *)y_out->ptr;
+    T * const yq[4] = {y, y + N_POINT / 4, y + N_POINT / 2, y + 3 * N_POINT / 4};
+    fft_tile<id, 1, 4, 1, true>(x, yq, WINDOW_NONE, FFT_FORWARD, 0, 0, 0);
+}
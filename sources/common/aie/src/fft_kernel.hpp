@@ -0,0 +1,39 @@
+#pragma once
+
+#include <aie_api/aie.hpp>
+#include <aie_api/aie_adf.hpp>
+#include "definition.hpp"
+#include "fft_types.hpp"
+#include "bfp.hpp"
+
+using namespace aie;
+
+// id: position of the tile in the stage-one decomposition, it consumes x[NUM_TILES*m+id]
+// window: run-time parameter, WINDOW_NONE/HANN/BLACKMAN of the whole frame
+// direction: run-time parameter, FFT_FORWARD/INVERSE (the tile conjugates its input)
+// out_shift: run-time parameter, right shift of the result (NUM_TILES 1 only,
+// otherwise stage two takes it)
+// band_lo, band_hi: run-time parameters, the bins band_lo ... band_hi-1 of the
+// 8K spectrum stage two computes; the tile (NUM_TILES 8 only) skips the
+// last-pass butterflies of the bins no row of the band needs
+template<unsigned id, unsigned NUM_TILES, typename T=cint16>
+void radix2_dit(input_window<T> * x_in,output_window<T> * y_out,int window,int direction,int out_shift,
+                int band_lo,int band_hi);
+
+// same transform, bins 0..N_POINT/2-1 and N_POINT/2..N_POINT-1 go to separate windows
+template<unsigned id, unsigned NUM_TILES, typename T>
+void radix2_dit_split(input_window<T> * x_in,output_window<T> * y_lo,output_window<T> * y_hi,int window,
+                      int direction,int out_shift,int band_lo,int band_hi);
+
+// four quarters of the bins, window q holds bins q*N_POINT/4 ... (q+1)*N_POINT/4-1
+template<unsigned id, unsigned NUM_TILES, typename T>
+void radix2_dit_split4(input_window<T> * x_in,output_window<T> * y_out0,output_window<T> * y_out1,
+                       output_window<T> * y_out2,output_window<T> * y_out3,int window,
+                       int direction,int out_shift,int band_lo,int band_hi);
+
+// inverse 1K transform (unscaled) of the bins x[N_POINT/4*q+j] = window q,
+// item j; y in natural order. id: tile of the convolution graph (profiling)
+template<unsigned id, typename T>
+void radix2_dit_inverse4(input_window<T> * x_in0,input_window<T> * x_in1,input_window<T> * x_in2,
+                         input_window<T> * x_in3,output_window<T> * y_out);
+// void fft_1k_init();
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+// Compile-time generation of the FFT constant tables (twiddles, DFT matrices,
+// bit-reversal indices, windows). Every table is a variable template, so a tile only
+// carries the tables its kernel instantiation actually references.
+
+#include <type_traits>
+
+namespace fft_tables {
+
+template<typename T, unsigned N>
+struct table {
+    T data[N];
+    constexpr unsigned size() const { return N; }
+};
+
+constexpr double PI=3.14159265358979323846;
+
+// Taylor series, only used on [0, pi/4] where 12 terms are below double precision
+constexpr double sin_series(double x)
+{
+    double term=x,sum=x;
+    for (int k=1;k<12;k++){
+        term*=-x*x/((2*k)*(2*k+1));
+        sum+=term;
+    }
+    return sum;
+}
+
+constexpr double cos_series(double x)
+{
+    double term=1,sum=1;
+    for (int k=1;k<12;k++){
+        term*=-x*x/((2*k-1)*(2*k));
+        sum+=term;
+    }
+    return sum;
+}
+
+// cos(2*pi*k/n) and sin(2*pi*k/n), reduced with exact integer arithmetic
+struct cs { double c,s; };
+
+constexpr cs turn(long k,long n)
+{
+    long r=((k%n)+n)%n;
+    long q=4*r/n,rem=4*r-q*n; // angle = (q + rem/n) * pi/2
+    double c=0,s=0;
+    if (2*rem<=n){
+        double phi=PI/2*rem/n;
+        c=cos_series(phi);
+        s=sin_series(phi);
+    } else {
+        double phi=PI/2*(n-rem)/n;
+        c=sin_series(phi);
+        s=cos_series(phi);
+    }
+    switch (q){
+    case 0: return {c,s};
+    case 1: return {-s,c};
+    case 2: return {-c,-s};
+    default: return {s,-c};
+    }
+}
+
+// Q-format quantization, truncating toward zero like the original tables
+constexpr int16 to_q(double v,unsigned shift)
+{
+    double scaled=v*(1<<shift);
+    if (scaled>32767) return 32767;
+    if (scaled<-32768) return -32768;
+    return (int16)scaled;
+}
+
+template<typename T>
+constexpr T make_w(long k,long n,unsigned shift)
+{
+    cs w=turn(-k,n);
+    if constexpr (std::is_same<T,cfloat>::value)
+        return T{(float)w.c,(float)w.s};
+    else
+        return T{to_q(w.c,shift),to_q(w.s,shift)};
+}
+
+// W_n^(step*k) for k in [0, LEN)
+template<typename T,unsigned LEN>
+constexpr table<T,LEN> make_twiddle(long n,long step,unsigned shift)
+{
+    table<T,LEN> t{};
+    for (unsigned k=0;k<LEN;k++) t.data[k]=make_w<T>(step*k,n,shift);
+    return t;
+}
+
+// P x P DFT matrix, entry (q, r) = W_P^(q*r)
+template<typename T,unsigned P>
+constexpr table<T,P*P> make_dft_matrix(unsigned shift)
+{
+    table<T,P*P> t{};
+    for (unsigned q=0;q<P;q++)
+        for (unsigned r=0;r<P;r++) t.data[q*P+r]=make_w<T>(q*r,P,shift);
+    return t;
+}
+
+constexpr unsigned log2(unsigned n)
+{
+    unsigned l=0;
+    while ((1u<<l)<n) l++;
+    return l;
+}
+
+constexpr unsigned bit_reverse(unsigned x,unsigned bits)
+{
+    unsigned r=0;
+    for (unsigned j=0;j<bits;j++){
+        if ((x>>j)&1) r|=1u<<(bits-j-1);
+    }
+    return r;
+}
+
+template<unsigned N>
+constexpr table<int16,N> make_bitrev()
+{
+    table<int16,N> t{};
+    for (unsigned i=0;i<N;i++) t.data[i]=(int16)bit_reverse(i,log2(N));
+    return t;
+}
+
+// periodic window of length n at sample k
+constexpr double window(unsigned kind,long k,long n)
+{
+    switch (kind){
+    case WINDOW_HANN: return 0.5-0.5*turn(k,n).c;
+    case WINDOW_BLACKMAN: return 0.42-0.5*turn(k,n).c+0.08*turn(2*k,n).c;
+    default: return 1;
+    }
+}
+
+// Window of stage-one tile id (it takes x[tiles*m+id] of an n-point frame)
+// in the order the first pass gathers its input: entry b*P+i belongs to
+// m = bitrev(b)+LEN/P*i, the i-th input of P-point block b.
+template<typename T,unsigned LEN,unsigned P>
+constexpr table<T,LEN> make_window(unsigned kind,long n,long tiles,long id,unsigned shift)
+{
+    constexpr unsigned STRIDE=LEN/P;
+    table<T,LEN> t{};
+    for (unsigned b=0;b<STRIDE;b++)
+        for (unsigned i=0;i<P;i++){
+            double w=window(kind,tiles*(bit_reverse(b,log2(STRIDE))+STRIDE*i)+id,n);
+            if constexpr (std::is_same<T,float>::value)
+                t.data[b*P+i]=(float)w;
+            else
+                t.data[b*P+i]=to_q(w,shift);
+        }
+    return t;
+}
+
+} // namespace fft_tables
+
+// ---------------------------------tables---------------------------------
+
+// omg<L>[k] = W_L^k for k < L/2, the twiddles of a length-L butterfly pass
+template<unsigned L,unsigned SHIFT=OMG_SHIFT,typename T=cint16>
+alignas(32) constexpr fft_tables::table<T,L/2> omg=fft_tables::make_twiddle<T,L/2>(L,1,SHIFT);
+
+// cross twiddles of stage-one tile id in an N-point transform: tf<N,id>[k] = W_N^(id*k)
+template<unsigned N,unsigned id,unsigned SHIFT=TF_SHIFT,typename T=cint16>
+alignas(32) constexpr fft_tables::table<T,N_POINT> tf=fft_tables::make_twiddle<T,N_POINT>(N,id,SHIFT);
+
+// P-point DFT matrix used by the first butterfly stage and by stage two
+template<unsigned P,unsigned SHIFT=MAT_OMG_SHIFT,typename T=cint16>
+alignas(32) constexpr fft_tables::table<T,P*P> mat_omg=fft_tables::make_dft_matrix<T,P>(SHIFT);
+
+// window KIND of stage-one tile id of an N-point transform, in gather order
+template<unsigned N,unsigned id,unsigned KIND,unsigned SHIFT=WIN_SHIFT,typename T=int16>
+alignas(32) constexpr fft_tables::table<T,N_POINT> win=
+    fft_tables::make_window<T,N_POINT,MAX_VEC_LEN>(KIND,N,N/N_POINT,id,SHIFT);
+
+// bitrev<N>[i] = i with its log2(N) bits reversed
+template<unsigned N>
+alignas(32) constexpr fft_tables::table<int16,N> bitrev=fft_tables::make_bitrev<N>();
@@ -0,0 +1,119 @@
+#pragma once
+
+// Sample types the kernels are instantiated for (FFT_DTYPE selects the one a
+// design is built with). The integer types keep Q1.14 cint16 twiddles, so a
+// cint32 multiply is cint32 x cint16 into cacc80; cfloat uses cfloat twiddles
+// and ignores every shift.
+
+#include <aie_api/aie.hpp>
+#include <type_traits>
+#include "definition.hpp"
+
+#ifndef FFT_DTYPE
+#define FFT_DTYPE cint16
+#endif
+
+template<typename T> struct fft_traits;
+
+template<> struct fft_traits<cint16> {
+    using coeff=cint16;
+    using real=int16;
+    using acc=cacc48;
+    static constexpr bool FLOAT=false;
+};
+
+template<> struct fft_traits<cint32> {
+    using coeff=cint16;
+    using real=int16;
+    using acc=cacc80;
+    static constexpr bool FLOAT=false;
+};
+
+template<> struct fft_traits<cfloat> {
+    using coeff=cfloat;
+    using real=float;
+    using acc=caccfloat;
+    static constexpr bool FLOAT=true;
+};
+
+template<typename T>
+using coeff_t=typename fft_traits<T>::coeff;
+
+// real coefficients (the windows), Q0.15 for the integer types
+template<typename T>
+using real_t=typename fft_traits<T>::real;
+
+// lanes of a 1024-bit vector of samples
+template<typename T>
+constexpr unsigned VEC_LEN=128/sizeof(T);
+
+// Stage two runs as this many kernels, each on a slice of the bins: eight
+// double-buffered 1K windows of a wider type would not fit around one tile.
+template<typename T>
+constexpr unsigned S2_SPLIT=sizeof(T)/sizeof(cint16);
+
+// Output streams of the 8-point stage two (FFT_OUT_STREAMS: 1, 2, 4 or 8).
+// One stream carries the whole frame while eight PLIOs feed stage one; a
+// kernel drives at most two streams, so more streams mean more kernels, each
+// on a slice of the bins. The wider types never run fewer than S2_SPLIT.
+#ifndef FFT_OUT_STREAMS
+#define FFT_OUT_STREAMS 1
+#endif
+static_assert(FFT_OUT_STREAMS==1 || FFT_OUT_STREAMS==2 || FFT_OUT_STREAMS==4 || FFT_OUT_STREAMS==8,
+              "stage two drives 1, 2, 4 or 8 output streams");
+
+// Welch averaging (FFT_WELCH): every 8-point stage-two kernel keeps a float
+// sum of the power of its bins across frames. 8 KB for a quarter of the bins
+// fits beside the input windows, a larger slice does not.
+#ifdef FFT_WELCH
+static_assert(FFT_OUT_STREAMS==8, "Welch averaging runs stage two as four kernels (FFT_OUT_STREAMS 8)");
+#endif
+
+template<typename T>
+constexpr unsigned S2_KERNELS=S2_SPLIT<T> > FFT_OUT_STREAMS/2 ? S2_SPLIT<T> : FFT_OUT_STREAMS/2;
+
+// streams of every stage-two kernel, each one carries 8/S2_STREAMS rows
+template<typename T>
+constexpr unsigned S2_STREAMS=FFT_OUT_STREAMS > S2_KERNELS<T> ? FFT_OUT_STREAMS/S2_KERNELS<T> : 1;
+
+// slices of the bins stage two of a NUM_TILES-way decomposition runs on;
+// the 2/4-point stages write a window per row and keep S2_SPLIT
+template<unsigned NUM_TILES, typename T>
+constexpr unsigned S2_SLICES=NUM_TILES==8 ? S2_KERNELS<T> : S2_SPLIT<T>;
+
+// Slices of the bins the middle of the convolution graph runs on, one
+// kernel each: the filter spectrum and eight windows in and out per kernel
+// only fit a tile's neighbourhood as quarters.
+constexpr unsigned CONV_SLICES=4;
+constexpr unsigned CONV_BINS=N_POINT/CONV_SLICES;
+
+// accumulator to samples, shifting only the fixed-point types
+template<typename T, typename A, unsigned V>
+static inline aie::vector<T,V> srs(const aie::accum<A,V> &acc, unsigned shift)
+{
+    if constexpr (fft_traits<T>::FLOAT)
+        return acc.template to_vector<T>();
+    else
+        return acc.template to_vector<T>(shift);
+}
+
+// samples times 2^-shift: a shift like srs for the fixed-point types, a
+// multiply for cfloat
+template<typename T, unsigned V>
+static inline aie::vector<T,V> downscale(const aie::vector<T,V> &v, unsigned shift)
+{
+    if constexpr (fft_traits<T>::FLOAT)
+        return shift ? aie::mul(v,1.0f/(float)(1u<<shift)).template to_vector<T>() : v;
+    else {
+        aie::accum<typename fft_traits<T>::acc,V> acc;
+        acc.from_vector(v);
+        return acc.template to_vector<T>(shift);
+    }
+}
+
+// the conjugate of the last stage of an inverse transform (direction RTP)
+template<typename T, unsigned V>
+static inline aie::vector<T,V> conj_if(const aie::vector<T,V> &v, bool inverse)
+{
+    return inverse ? aie::conj(v) : v;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// Cycle stamps at the stage boundaries of a kernel (FFT_PROFILE). A kernel
+// keeps a stamps<N> for one invocation, calls mark() after each of its N
+// stages and report() at the end, which prints a single line
+//     FFT_PROFILE <kernel> <id> <iteration> <stage>=<cycles> ... total=<cycles>
+// to the simulator log; tools/fft_profile.py turns those lines into a
+// per-stage table. The stamps live in registers/stack of the tile and are
+// printed only after the last stage, so the printf does not land inside a
+// measured stage. Without FFT_PROFILE every call compiles away.
+
+#include <aie_api/aie.hpp>
+#ifdef FFT_PROFILE
+#include <cstdio>
+#endif
+
+namespace prof {
+
+template<unsigned N>
+class stamps {
+#ifdef FFT_PROFILE
+    unsigned long long t[N+1];
+    const char *stage[N+1];
+    unsigned n=0;
+public:
+    stamps() { mark("start"); }
+    void mark(const char *name)
+    {
+        if (n<=N){
+            stage[n]=name;
+            t[n++]=aie::tile::current().cycles();
+        }
+    }
+    // kernel, id: the kernel and its tile id; calls: invocation counter of
+    // the kernel (a static of the kernel, one copy per tile)
+    void report(const char *kernel,unsigned id,unsigned &calls) const
+    {
+        printf("FFT_PROFILE %s %u %u",kernel,id,calls++);
+        for (unsigned i=1;i<n;i++) printf(" %s=%llu",stage[i],t[i]-t[i-1]);
+        printf(" total=%llu\n",t[n-1]-t[0]);
+    }
+#else
+public:
+    void mark(const char *) {}
+    void report(const char *,unsigned,unsigned &) const {}
+#endif
+};
+
+} // namespace prof
@@ -0,0 +1,73 @@
+#pragma once
+
+// Output modes of the 8-point stage two (output_mode RTP). FFT_OUT_POWER
+// writes |X|^2 of every bin as a bfloat16 (the upper half of a float),
+// FFT_OUT_DB 10*log10(|X|^2) as an int16 in 1/128 dB: 2 bytes a bin, half a
+// cint16 bin. Both are absolute: the block exponent is folded in, so frames
+// of different exponents average (Welch, FFT_WELCH, in float) and compare
+// directly.
+
+#include <aie_api/aie.hpp>
+#include "definition.hpp"
+#include "fft_types.hpp"
+
+namespace spectrum {
+
+using namespace aie;
+
+constexpr int32 FLOAT_ONE=127<<23;  // bits of 1.0f, the bias of the exponent
+constexpr int16 LOG2_CORR=11358;    // 0.3466 in Q15, see decibel()
+constexpr int16 DB_PER_LOG2=12330;  // 10*log10(2)*128 in Q5
+constexpr int32 LOG2_LIMIT=85<<23;  // +-256 dB, the int16 range
+
+// 4^e, the power of block exponent e
+static inline float gain(int e)
+{
+    union { int32 i; float f; } u;
+    u.i=FLOAT_ONE+2*e*(1<<23);
+    return u.f;
+}
+
+// |X|^2 as float: the fixed-point parts convert exactly, squares and sum
+// round once each
+template<typename T, unsigned V>
+static inline vector<float,V> power(const vector<T,V> &x)
+{
+    vector<float,2*V> f;
+    if constexpr (fft_traits<T>::FLOAT)
+        f=vector_cast<float>(x);
+    else if constexpr (std::is_same<T,cint32>::value)
+        f=to_float(vector_cast<int32>(x));
+    else
+        f=to_float(accum<acc48,2*V>(vector_cast<int16>(x)).template to_vector<int32>(0));
+    auto sq=mul(f,f).template to_vector<float>();
+    return add(filter_even(sq,1),filter_odd(sq,1));
+}
+
+// p as bfloat16: the sign, exponent and top 7 mantissa bits of the float,
+// rounded to nearest (half up), so 0.4 % at worst and the range of a float
+template<unsigned V>
+static inline vector<int16,V> bfloat16(const vector<float,V> &p)
+{
+    auto bits=add(vector_cast<int32>(p),broadcast<int32,V>(1<<15));
+    return accum<acc80,V>(bits).template to_vector<int16>(16);
+}
+
+// 10*log10(p) in 1/128 dB from the bits of p: the exponent field is the
+// integer part of log2(p) and the mantissa m its fraction to first order;
+// adding 0.3466*m*(1-m) leaves an error below 0.04 dB. Clamped to +-256 dB,
+// so a zero bin reads -256 dB.
+template<unsigned V>
+static inline vector<int16,V> decibel(const vector<float,V> &p)
+{
+    auto bits=vector_cast<int32>(p);
+    auto x=sub(bits,broadcast<int32,V>(FLOAT_ONE));
+    // m and 1-m in Q15
+    auto m=accum<acc80,V>(bit_and((int32)0x7fffff,bits)).template to_vector<int16>(8);
+    auto c=mul(m,sub(broadcast<int16,V>(32767),m)).template to_vector<int32>(0);
+    x=add(x,mul(c,LOG2_CORR).template to_vector<int32>(15+7));
+    x=max(min(x,broadcast<int32,V>(LOG2_LIMIT)),broadcast<int32,V>(-LOG2_LIMIT));
+    return mul(x,DB_PER_LOG2).template to_vector<int16>(23+5);
+}
+
+} // namespace spectrum
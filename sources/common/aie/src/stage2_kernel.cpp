@@ -0,0 +1,340 @@
+#include "stage2_kernel.hpp"
+#include "profile.hpp"
+#include "spectrum.hpp"
+#include <aie_api/utils.hpp>
+#include <cstdio>
+
+// lanes per sliding_mul, 4 or 8 for cint16 x cint16
+template<unsigned NUM_TILES>
+constexpr unsigned len_load_x=NUM_TILES==8?4:8;
+
+template<unsigned NUM_TILES>
+using sliding_mul=sliding_mul_ops<len_load_x<NUM_TILES>,NUM_TILES,1,len_load_x<NUM_TILES>,1,cint16,cint16,cacc48>;
+
+// bins of every input window, a kernel of a split stage two sees one slice
+template<unsigned NUM_TILES, typename T>
+constexpr unsigned BINS=N_POINT/S2_SLICES<NUM_TILES,T>;
+
+// row q of the butterfly for the len_load_x bins starting at i*len_load_x
+template<unsigned NUM_TILES, typename T>
+static inline vector<T,len_load_x<NUM_TILES>> stage2_row(const vector<T,len_load_x<NUM_TILES>*NUM_TILES> &x,unsigned q,unsigned s)
+{
+    constexpr unsigned LEN_LOAD_X=len_load_x<NUM_TILES>;
+    if constexpr (std::is_same<T,cint16>::value){
+        auto res=sliding_mul<NUM_TILES>::mul(load_v<NUM_TILES>(mat_omg<NUM_TILES>.data+q*NUM_TILES),0,x,0);
+        return res.template to_vector<cint16>(MAT_OMG_SHIFT+s);
+    } else {
+        // the wider types take the same sum as one scalar-coefficient MAC per tile
+        const coeff_t<T> *w=mat_omg<NUM_TILES,MAT_OMG_SHIFT,coeff_t<T>>.data+q*NUM_TILES;
+        auto res=mul(x.template extract<LEN_LOAD_X>(0),w[0]);
+        for (unsigned t=1;t<NUM_TILES;t++)
+            chess_unroll_loop()
+        {
+            res=mac(res,x.template extract<LEN_LOAD_X>(t),w[t]);
+        }
+        // cfloat rounds without a shift, it scales by 2^-s instead (out_shift only, no BFP)
+        if constexpr (fft_traits<T>::FLOAT)
+            return downscale(srs<T>(res,0),s);
+        else
+            return srs<T>(res,MAT_OMG_SHIFT+s);
+    }
+}
+
+// d: per-tile exponent alignment shifts (FFT_BFP)
+template<unsigned NUM_TILES, typename T>
+static inline vector<T,len_load_x<NUM_TILES>*NUM_TILES> stage2_load(T * const *x,const unsigned *d,unsigned i)
+{
+    constexpr unsigned LEN_LOAD_X=len_load_x<NUM_TILES>;
+    vector<T,LEN_LOAD_X*NUM_TILES> v;
+    for (unsigned t=0;t<NUM_TILES;t++)
+        chess_unroll_loop()
+    {
+        v.insert(t,bfp::downshift(load_v<LEN_LOAD_X>(x[t]+i*LEN_LOAD_X),d[t]));
+    }
+    return v;
+}
+
+// Power or dB rows of the 8-point stage two (output_mode), with FFT_WELCH
+// the mean over average frames: the power sums wait in w, in the order the
+// bins leave, and the frames in between write nothing. A change of
+// output_mode or average restarts the mean. Power (bfloat16) and dB send
+// groups i and i+1 of a row together, 8 bins in the 16 bytes of 4 complex
+// ones. Returns whether the frame wrote its rows.
+template<unsigned STREAMS, typename T>
+static inline bool spectrum_8(T * const *x,output_stream<T> * const *y,const unsigned *d,unsigned s,int e,
+                              int mode,int average,welch_sums<T> &w,bfp::peak<len_load_x<8>,T> &pk)
+{
+    constexpr unsigned ROWS=8/STREAMS;
+    constexpr unsigned LEN_LOAD_X=len_load_x<8>;
+#ifdef FFT_WELCH
+    if (mode!=w.mode || average!=w.average){
+        w.count=0;
+        w.mode=mode;
+        w.average=average;
+    }
+    bool welch=average>1,first=w.count==0,emit=!welch || ++w.count==average;
+    if (emit) w.count=0;
+    float inv=welch?1.0f/average:1.0f;
+#else
+    bool emit=true;
+#endif
+    float g=spectrum::gain(e);
+
+    for (unsigned i=0;i<BINS<8,T>/LEN_LOAD_X;i+=2){
+        vector<int16,LEN_LOAD_X> lo[8];
+        for (unsigned k=0;k<2;k++){
+            auto v=stage2_load<8>(x,d,i+k);
+            for (unsigned q=0;q<8;q++)
+                chess_unroll_loop()
+            {
+                auto r=stage2_row<8>(v,q,s);
+                pk.update(r);
+                auto p=mul(spectrum::power(r),g).template to_vector<float>();
+#ifdef FFT_WELCH
+                if (welch){
+                    float *a=w.sum+((i+k)*8+q)*LEN_LOAD_X;
+                    if (!first) p=add(p,load_v<LEN_LOAD_X>(a));
+                    if (emit) p=mul(p,inv).template to_vector<float>();
+                    else store_v(a,p);
+                }
+#endif
+                if (!emit) continue;
+                auto b=mode==FFT_OUT_POWER ? spectrum::bfloat16(p) : spectrum::decibel(p);
+                if (k==0) lo[q]=b;
+                else writeincr(y[q/ROWS],vector_cast<T>(concat(lo[q],b)));
+            }
+        }
+    }
+    return emit;
+}
+
+// The bins band_lo ... band_hi-1 of slice h, row by row: stream g sends the
+// groups of its rows that lie in the band, in natural order. Each group loads
+// the eight tiles for its row alone, so the work follows the width of the band.
+template<unsigned h, unsigned STREAMS, typename T>
+static inline void band_8(T * const *x,output_stream<T> * const *y,const unsigned *d,unsigned s,bool inverse,
+                          int band_lo,int band_hi,bfp::peak<len_load_x<8>,T> &pk)
+{
+    constexpr unsigned ROWS=8/STREAMS;
+    constexpr int LEN_LOAD_X=len_load_x<8>;
+    constexpr int SLICE=BINS<8,T>;
+    for (unsigned q=0;q<8;q++){
+        // bins of row q of the slice in the band, as groups of the slice
+        int base=N_POINT*q+h*SLICE;
+        int first=band_lo-base, last=band_hi-base;
+        first=first<0?0:first/LEN_LOAD_X;
+        last=last>SLICE?SLICE/LEN_LOAD_X:last/LEN_LOAD_X;
+        for (int i=first;i<last;i++){
+            auto r=conj_if(stage2_row<8>(stage2_load<8>(x,d,i),q,s),inverse);
+            writeincr(y[q/ROWS],r);
+            pk.update(r);
+        }
+    }
+}
+
+// STREAMS output streams, stream g carries rows g*8/STREAMS ... of slice h.
+// The last stage of the transform: the rounding of the rows takes out_shift
+// (bfp::scale), an inverse transform conjugates them. output_mode other than
+// FFT_OUT_COMPLEX sends the spectrum_8 rows instead, a band narrower than the
+// spectrum the band_8 ones.
+template<unsigned h, unsigned STREAMS, typename T>
+static inline void stage2_8(T * const *x,output_stream<T> * const *y,int direction,int out_shift,int mode,int average,
+                            int band_lo,int band_hi,welch_sums<T> &w)
+{
+    constexpr unsigned ROWS=8/STREAMS;
+    static unsigned calls;
+    prof::stamps<2> st;
+
+    unsigned d[8],p;
+    int e=bfp::align<8,BINS<8,T>>(x,d,p);
+    unsigned s=bfp::shift(p,bfp::dft_growth<8>);
+    unsigned o=bfp::scale(out_shift,e);
+    bool inverse=direction==FFT_INVERSE;
+    bfp::peak<len_load_x<8>,T> pk;
+    st.mark("align");
+
+    bool emit=true;
+    if (mode!=FFT_OUT_COMPLEX){
+        emit=spectrum_8<STREAMS>(x,y,d,s+o,e+s,mode,average,w,pk);
+    } else if (band_lo!=0 || band_hi!=MAX_TILES*N_POINT){
+        band_8<h,STREAMS>(x,y,d,s+o,inverse,band_lo,band_hi,pk);
+    } else {
+        for (unsigned i=0;i<BINS<8,T>/len_load_x<8>;i++){
+            auto v=stage2_load<8>(x,d,i);
+            for (unsigned q=0;q<8;q++)
+                chess_unroll_loop()
+            {
+                auto r=conj_if(stage2_row<8>(v,q,s+o),inverse);
+                writeincr(y[q/ROWS],r);
+                pk.update(r);
+            }
+        }
+    }
+    if (emit)
+        for (unsigned g=0;g<STREAMS;g++) bfp::write_trailer(y[g],e+s,pk.value());
+    // includes the stalls on a full output stream
+    st.mark("dft8");
+    st.report("fft_stage2",h,calls);
+}
+
+template<unsigned h, typename T>
+void fft_stage2<h,T>::run(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                          input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+                          output_stream<T> *y_out,int direction,int out_shift,int output_mode,int average,
+                          int band_lo,int band_hi)
+{
+    T *x[8]={(T*)x_in0->ptr,(T*)x_in1->ptr,(T*)x_in2->ptr,(T*)x_in3->ptr,
+             (T*)x_in4->ptr,(T*)x_in5->ptr,(T*)x_in6->ptr,(T*)x_in7->ptr};
+    output_stream<T> *y[1]={y_out};
+    stage2_8<h,1>(x,y,direction,out_shift,output_mode,average,band_lo,band_hi,welch);
+}
+
+template<unsigned h, typename T>
+void fft_stage2_dual<h,T>::run(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                               input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+                               output_stream<T> *y_lo,output_stream<T> *y_hi,int direction,int out_shift,
+                               int output_mode,int average,int band_lo,int band_hi)
+{
+    T *x[8]={(T*)x_in0->ptr,(T*)x_in1->ptr,(T*)x_in2->ptr,(T*)x_in3->ptr,
+             (T*)x_in4->ptr,(T*)x_in5->ptr,(T*)x_in6->ptr,(T*)x_in7->ptr};
+    output_stream<T> *y[2]={y_lo,y_hi};
+    stage2_8<h,2>(x,y,direction,out_shift,output_mode,average,band_lo,band_hi,welch);
+}
+
+// Middle of the convolution graph on slice h of the bins: the forward 8-point
+// stage, the product with the filter spectrum and the 8-point stage of the
+// inverse transform. The inverse DFT across the rows is the forward one with
+// row t read as row -t, and the cross twiddles of inverse tile t, W_N^(-t*r),
+// are tf<N, N-t>. The products wait in the output windows (row q in z[q]),
+// so the inverse stage shifts by just the growth their peak leaves room for.
+template<unsigned h, typename T>
+void conv_stage2(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                 input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+                 output_window<T> *z_out0,output_window<T> *z_out1,output_window<T> *z_out2,output_window<T> *z_out3,
+                 output_window<T> *z_out4,output_window<T> *z_out5,output_window<T> *z_out6,output_window<T> *z_out7,
+                 const coeff_t<T> (&filter)[MAX_TILES*CONV_BINS],int shift)
+{
+    constexpr unsigned N=MAX_TILES*N_POINT;
+    constexpr unsigned LEN_LOAD_X=len_load_x<8>;
+    T *x[8]={(T*)x_in0->ptr,(T*)x_in1->ptr,(T*)x_in2->ptr,(T*)x_in3->ptr,
+             (T*)x_in4->ptr,(T*)x_in5->ptr,(T*)x_in6->ptr,(T*)x_in7->ptr};
+    T *z[8]={(T*)z_out0->ptr,(T*)z_out1->ptr,(T*)z_out2->ptr,(T*)z_out3->ptr,
+             (T*)z_out4->ptr,(T*)z_out5->ptr,(T*)z_out6->ptr,(T*)z_out7->ptr};
+    const coeff_t<T> *tw[8]={nullptr,
+                             tf<N,N-1,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,tf<N,N-2,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,
+                             tf<N,N-3,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,tf<N,N-4,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,
+                             tf<N,N-5,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,tf<N,N-6,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS,
+                             tf<N,N-7,TF_SHIFT,coeff_t<T>>.data+h*CONV_BINS};
+    static unsigned calls;
+    prof::stamps<2> st;
+
+    unsigned d[8],p;
+    int e=bfp::align<8,CONV_BINS>(x,d,p);
+    unsigned s=bfp::shift(p,bfp::dft_growth<8>);
+    bfp::peak<LEN_LOAD_X,T> py,pk;
+    st.mark("align");
+
+    for (unsigned i=0;i<CONV_BINS/LEN_LOAD_X;i++){
+        auto v=stage2_load<8>(x,d,i);
+        // row q: bins N_POINT*q+h*CONV_BINS+i*LEN_LOAD_X ..., the filter slice is row-major too
+        for (unsigned q=0;q<8;q++)
+            chess_unroll_loop()
+        {
+            auto r=stage2_row<8>(v,q,s);
+            auto y=srs<T>(mul(r,load_v<LEN_LOAD_X>(filter+q*CONV_BINS+i*LEN_LOAD_X)),shift);
+            store_v(z[q]+i*LEN_LOAD_X,y);
+            py.update(y);
+        }
+    }
+    unsigned g=bfp::shift(py.value(),bfp::dft_growth<8>);
+
+    for (unsigned i=0;i<CONV_BINS/LEN_LOAD_X;i++){
+        vector<T,LEN_LOAD_X*8> u;
+        for (unsigned q=0;q<8;q++)
+            chess_unroll_loop()
+        {
+            u.insert(q,load_v<LEN_LOAD_X>(z[q]+i*LEN_LOAD_X));
+        }
+        for (unsigned t=0;t<8;t++)
+            chess_unroll_loop()
+        {
+            auto r=stage2_row<8>(u,(8-t)%8,g);
+            if (t!=0) r=srs<T>(mul(r,load_v<LEN_LOAD_X>(tw[t]+i*LEN_LOAD_X)),TF_SHIFT);
+            store_v(z[t]+i*LEN_LOAD_X,r);
+            pk.update(r);
+        }
+    }
+    for (unsigned t=0;t<8;t++) bfp::write_trailer(z[t]+CONV_BINS,e+s+g,pk.value());
+    st.mark("conv");
+    st.report("conv_stage2",h,calls);
+}
+
+template<typename T>
+void fft_stage2_4(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                  output_window<T> *y_out0,output_window<T> *y_out1,output_window<T> *y_out2,output_window<T> *y_out3,
+                  int direction,int out_shift)
+{
+    T *x[4]={(T*)x_in0->ptr,(T*)x_in1->ptr,(T*)x_in2->ptr,(T*)x_in3->ptr};
+    T *y[4]={(T*)y_out0->ptr,(T*)y_out1->ptr,(T*)y_out2->ptr,(T*)y_out3->ptr};
+    static unsigned calls;
+    prof::stamps<2> st;
+
+    unsigned d[4],p;
+    int e=bfp::align<4,BINS<4,T>>(x,d,p);
+    unsigned s=bfp::shift(p,bfp::dft_growth<4>);
+    unsigned o=bfp::scale(out_shift,e);
+    bool inverse=direction==FFT_INVERSE;
+    bfp::peak<len_load_x<4>,T> pk;
+    st.mark("align");
+
+    for (unsigned i=0;i<BINS<4,T>/len_load_x<4>;i++){
+        auto v=stage2_load<4>(x,d,i);
+        for (unsigned q=0;q<4;q++)
+            chess_unroll_loop()
+        {
+            auto r=conj_if(stage2_row<4>(v,q,s+o),inverse);
+            store_v(y[q]+i*len_load_x<4>,r);
+            pk.update(r);
+        }
+    }
+    for (unsigned q=0;q<4;q++) bfp::write_trailer(y[q]+BINS<4,T>,e+s,pk.value());
+    st.mark("dft4");
+    st.report("fft_stage2_4",0,calls);
+}
+
+template<typename T>
+void fft_stage2_2(input_window<T> *x_in0,input_window<T> *x_in1,
+                  output_window<T> *y_out0,output_window<T> *y_out1,int direction,int out_shift)
+{
+    constexpr unsigned V=VEC_LEN<T>;
+    T *x[2]={(T*)x_in0->ptr,(T*)x_in1->ptr};
+    T *y[2]={(T*)y_out0->ptr,(T*)y_out1->ptr};
+    static unsigned calls;
+    prof::stamps<2> st;
+    unsigned d[2],p;
+    int e=bfp::align<2,BINS<2,T>>(x,d,p);
+    unsigned s=bfp::shift(p,bfp::dft_growth<2>);
+    unsigned o=bfp::scale(out_shift,e);
+    bool inverse=direction==FFT_INVERSE;
+    bfp::peak<V,T> pk;
+    st.mark("align");
+
+    // W_2 only holds +-1, a plain butterfly gives the same result as the matrix product
+    auto iterx0=begin_vector<V>(x[0]);
+    auto iterx1=begin_vector<V>(x[1]);
+    auto itery0=begin_vector<V>(y[0]);
+    auto itery1=begin_vector<V>(y[1]);
+    for (unsigned i=0;i<BINS<2,T>/V;i++){
+        vector<T,V> v_0=bfp::downshift(*iterx0++,d[0]+s);
+        vector<T,V> v_1=bfp::downshift(*iterx1++,d[1]+s);
+        vector<T,V> r_0=conj_if(downscale(add(v_0,v_1),o),inverse);
+        vector<T,V> r_1=conj_if(downscale(sub(v_0,v_1),o),inverse);
+        *itery0++=r_0;
+        *itery1++=r_1;
+        pk.update(r_0);
+        pk.update(r_1);
+    }
+    for (unsigned q=0;q<2;q++) bfp::write_trailer(y[q]+BINS<2,T>,e+s,pk.value());
+    st.mark("dft2");
+    st.report("fft_stage2_2",0,calls);
+}
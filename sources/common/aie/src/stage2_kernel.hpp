@@ -0,0 +1,89 @@
+#pragma once
+
+#include <adf.h>
+#include <aie_api/aie.hpp>
+#include <aie_api/aie_adf.hpp>
+#include "definition.hpp"
+#include "fft_types.hpp"
+#include "bfp.hpp"
+
+using namespace aie;
+
+// Welch state of an 8-tile stage two (FFT_WELCH): the power sums of the
+// frames so far, in the order the bins of its slice leave, and the
+// output_mode and average they were taken with.
+template<typename T>
+struct welch_sums {
+#ifdef FFT_WELCH
+    alignas(32) float sum[8*N_POINT/S2_SLICES<8,T>];
+    int mode=0,average=0,count=0;
+#endif
+};
+
+// NUM_TILES-point DFT across the stage-one tiles.
+// 8 tiles: bins are streamed as groups of 4, row by row (bin 4i+l+N_POINT*q at 32i+4q+l).
+// 2/4 tiles: row q of the result (bins N_POINT*q ... N_POINT*q+N_POINT-1) goes to window q.
+// With FFT_BFP the inputs are aligned to the largest tile exponent and every
+// output (stream or window) ends with a trailer carrying the frame exponent.
+// A split stage two (S2_SLICES > 1) runs one instance per slice of the bins.
+// direction/out_shift: run-time parameters, FFT_FORWARD/INVERSE (the rows
+// are conjugated) and the right shift of the result (with FFT_BFP the exponent).
+// 8 tiles, output_mode: FFT_OUT_COMPLEX, or every bin as power (bfloat16)
+// or dB (int16, 1/128 dB) with the exponent folded in; average: frames per output,
+// the mean of their power (FFT_WELCH builds, 1 otherwise).
+// 8 tiles, h: the slice of the bins (N_POINT*q + h*BINS ...) the kernel
+// computes; band_lo, band_hi: with FFT_OUT_COMPLEX and other than 0 and
+// 8*N_POINT, only the bins band_lo ... band_hi-1 (multiples of 4), every
+// stream sending those of its rows row by row, in natural order.
+// The 8-tile kernels are objects (kernel::create_object): the Welch sums
+// live in the object, so every kernel of every instance averages its own
+// frames, in x86sim as well.
+template<unsigned h, typename T=cint16>
+class fft_stage2 {
+public:
+    void run(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+             input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+             output_stream<T> *y_out,int direction,int out_shift,int output_mode,int average,
+             int band_lo,int band_hi);
+    static void registerKernelClass() { REGISTER_FUNCTION(fft_stage2::run); }
+
+private:
+    welch_sums<T> welch;
+};
+
+// 8 tiles, two output streams: rows 0-3 of the result leave through y_lo,
+// rows 4-7 through y_hi, each stream in the order above
+template<unsigned h, typename T=cint16>
+class fft_stage2_dual {
+public:
+    void run(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+             input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+             output_stream<T> *y_lo,output_stream<T> *y_hi,int direction,int out_shift,
+             int output_mode,int average,int band_lo,int band_hi);
+    static void registerKernelClass() { REGISTER_FUNCTION(fft_stage2_dual::run); }
+
+private:
+    welch_sums<T> welch;
+};
+
+// Convolution graph, slice h of the bins (CONV_BINS of every row): X = the
+// 8-point stage of the forward transform, Y = X * filter / 2^shift, and the
+// 8-point stage of the unscaled inverse transform of Y with its cross
+// twiddles; z_out<t> feeds inverse tile t. filter: the spectrum H[N_POINT*q+
+// h*CONV_BINS+j] at q*CONV_BINS+j (run-time parameter). With FFT_BFP every
+// output ends with the exponent trailer of the slice.
+template<unsigned h, typename T=cint16>
+void conv_stage2(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                 input_window<T> *x_in4,input_window<T> *x_in5,input_window<T> *x_in6,input_window<T> *x_in7,
+                 output_window<T> *z_out0,output_window<T> *z_out1,output_window<T> *z_out2,output_window<T> *z_out3,
+                 output_window<T> *z_out4,output_window<T> *z_out5,output_window<T> *z_out6,output_window<T> *z_out7,
+                 const coeff_t<T> (&filter)[MAX_TILES*CONV_BINS],int shift);
+
+template<typename T=cint16>
+void fft_stage2_4(input_window<T> *x_in0,input_window<T> *x_in1,input_window<T> *x_in2,input_window<T> *x_in3,
+                  output_window<T> *y_out0,output_window<T> *y_out1,output_window<T> *y_out2,output_window<T> *y_out3,
+                  int direction,int out_shift);
+
+template<typename T=cint16>
+void fft_stage2_2(input_window<T> *x_in0,input_window<T> *x_in1,
+                  output_window<T> *y_out0,output_window<T> *y_out1,int direction,int out_shift);
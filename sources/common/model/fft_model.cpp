@@ -0,0 +1,644 @@
+#include "fft_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace fft_model {
+
+// ------------------------------arithmetic------------------------------
+
+// components of the sample type T
+template<typename T>
+using part_t = decltype(T::real);
+
+// complex accumulator, wide enough for every sum the kernels form
+struct cacc { int64_t re, im; };
+
+template<typename A, typename B>
+static inline cacc mul(A a, B b)
+{
+    return {(int64_t)a.real * b.real - (int64_t)a.imag * b.imag,
+            (int64_t)a.real * b.imag + (int64_t)a.imag * b.real};
+}
+
+template<typename A, typename B>
+static inline cacc mac(cacc acc, A a, B b)
+{
+    cacc p = mul(a, b);
+    return {acc.re + p.re, acc.im + p.im};
+}
+
+// the low bits of v, as many as a component of T has
+template<typename T>
+static inline part_t<T> wrap(int64_t v) { return (part_t<T>)(std::make_unsigned_t<part_t<T>>)(uint64_t)v; }
+
+// to_vector<T>(s): arithmetic (floor) shift, then the low bits
+template<typename T>
+static inline T srs(cacc a, unsigned s) { return {wrap<T>(a.re >> s), wrap<T>(a.im >> s)}; }
+
+template<typename T>
+static inline T add(T a, T b) { return {wrap<T>((int64_t)a.real + b.real), wrap<T>((int64_t)a.imag + b.imag)}; }
+template<typename T>
+static inline T sub(T a, T b) { return {wrap<T>((int64_t)a.real - b.real), wrap<T>((int64_t)a.imag - b.imag)}; }
+
+// bfp::downshift, downscale
+template<typename T>
+static inline T downshift(T a, unsigned s) { return {(part_t<T>)(a.real >> s), (part_t<T>)(a.imag >> s)}; }
+
+// conj_if
+template<typename T>
+static inline T conj_if(T a, bool inverse) { return inverse ? T{a.real, wrap<T>(-(int64_t)a.imag)} : a; }
+
+// bfp::peak: largest component and negated smallest component, both from 0
+struct peak {
+    int64_t hi = 0, lo = 0;
+    template<typename T>
+    void update(T v)
+    {
+        hi = std::max(hi, (int64_t)std::max(v.real, v.imag));
+        lo = std::min(lo, (int64_t)std::min(v.real, v.imag));
+    }
+    unsigned value() const { return std::max(hi, -lo); }
+};
+
+// the BFP trailer, cint16 only
+template<typename T>
+static inline T trailer0(int e, unsigned p) { return {(part_t<T>)e, (part_t<T>)(p > 32767 ? 32767 : p)}; }
+
+template<typename T>
+static inline void push_trailer(std::vector<T> &out, int e, unsigned p)
+{
+    out.push_back(trailer0<T>(e, p));
+    for (unsigned i = 1; i < MAX_VEC_LEN; i++) out.push_back({0, 0});
+}
+
+// ------------------------------spectrum------------------------------
+
+// the constants of spectrum.hpp
+constexpr int32_t FLOAT_ONE = 127 << 23;
+constexpr int16 LOG2_CORR = 11358;
+constexpr int16 DB_PER_LOG2 = 12330;
+constexpr int32_t LOG2_LIMIT = 85 << 23;
+
+// spectrum::power: the parts convert to float (exactly for cint16), squares
+// and sum round once each
+template<typename T>
+static inline float power(T v)
+{
+    float re = v.real, im = v.imag;
+    float re2 = re * re, im2 = im * im;
+    return re2 + im2;
+}
+
+static inline int32_t bits_of(float p)
+{
+    int32_t u;
+    std::memcpy(&u, &p, sizeof(u));
+    return u;
+}
+
+// spectrum::bfloat16: rounded half up, the upper 16 bits
+static inline int16 bfloat16(float p) { return wrap<cint16>((int64_t)(bits_of(p) + (1 << 15)) >> 16); }
+
+// spectrum::decibel, the same integer steps: 1/128 dB from the bits of p
+static inline int16 decibel(float p)
+{
+    int32_t bits = bits_of(p);
+    int64_t x = (int64_t)bits - FLOAT_ONE;
+    int64_t m = wrap<cint16>((bits & 0x7fffff) >> 8);
+    int64_t c = m * wrap<cint16>(32767 - m);
+    x += (c * LOG2_CORR) >> (15 + 7);
+    x = std::max(std::min(x, (int64_t)LOG2_LIMIT), (int64_t)-LOG2_LIMIT);
+    return wrap<cint16>((x * DB_PER_LOG2) >> (23 + 5));
+}
+
+// ------------------------------pipeline------------------------------
+
+// slices of the bins of the convolution graph, one conv_stage2 kernel each (fft_types.hpp)
+constexpr unsigned CONV_SLICES = 4, CONV_BINS = N_POINT / CONV_SLICES;
+
+template<typename T>
+pipeline<T>::pipeline(unsigned num_tiles, bool bfp, unsigned out_streams, int window, int direction, unsigned out_shift)
+    : num_tiles(num_tiles), bfp(bfp), out_streams(out_streams), window(window), direction(direction),
+      out_shift(out_shift), band_lo(0), band_hi(num_tiles * N_POINT), tw(num_tiles * N_POINT),
+      win(num_tiles * N_POINT)
+{
+    for (unsigned id = 0; id < num_tiles; id++) {
+        for (unsigned k = 0; k < N_POINT; k++)
+            tw[id * N_POINT + k] = fft_tables::make_w<cint16>((long)id * k, num_tiles * N_POINT, TF_SHIFT);
+        auto t = fft_tables::make_window<int16, N_POINT, MAX_VEC_LEN>(window, num_tiles * N_POINT, num_tiles, id, WIN_SHIFT);
+        std::copy(t.data, t.data + N_POINT, win.begin() + id * N_POINT);
+    }
+}
+
+template<typename T>
+void pipeline<T>::set_band(int lo, int hi)
+{
+    band_lo = lo;
+    band_hi = hi;
+}
+
+template<typename T>
+void pipeline<T>::set_output(int mode, int average)
+{
+    this->mode = mode;
+    this->average = average;
+    count = 0;
+    sums.assign(average > 1 ? MAX_TILES * N_POINT : 0, 0.0f);
+}
+
+template<typename T>
+void pipeline<T>::set_filter(const cint16 *filter, unsigned shift)
+{
+    const unsigned n = MAX_TILES * N_POINT;
+    this->filter.assign(filter, filter + n);
+    filter_shift = shift;
+    itw.resize(n);
+    for (unsigned t = 0; t < MAX_TILES; t++)
+        for (unsigned k = 0; k < N_POINT; k++)
+            itw[t * N_POINT + k] = fft_tables::make_w<cint16>((long)(n - t) * k, n, TF_SHIFT);
+}
+
+template<typename T>
+unsigned pipeline<T>::shift(unsigned peak, unsigned growth) const
+{
+    if (!bfp) return 0;
+    unsigned bits = 0;
+    while (peak >> bits) bits++;
+    return bits + growth > 15 ? bits + growth - 15 : 0;
+}
+
+template<typename T>
+void pipeline<T>::tile_input(const T *x, unsigned id, T *in) const
+{
+    for (unsigned m = 0; m < N_POINT; m++) in[m] = x[num_tiles * m + id];
+}
+
+template<typename T>
+void pipeline<T>::tile(unsigned id, const T *x_in, T *y) const
+{
+    constexpr unsigned STRIDE = N_POINT / MAX_VEC_LEN;
+    const bool inverse = direction == FFT_INVERSE;
+    T in[N_POINT];
+    peak pk;
+
+    // an inverse transform conjugates the input
+    for (unsigned i = 0; i < N_POINT; i++) in[i] = conj_if(x_in[i], inverse);
+
+    // input scan
+    for (unsigned i = 0; i < N_POINT; i++) pk.update(in[i]);
+    unsigned s = shift(pk.value(), 4);
+    int e = s;
+
+    // bfp::guard: fractional bits of the windowed samples, the headroom of
+    // the input peak (measured for the window without BFP as well); cint32
+    // keeps a fixed 12
+    unsigned g = 0;
+    if (window != WINDOW_NONE && std::is_same<T, cint32>::value) {
+        g = 12;
+    } else if (window != WINDOW_NONE) {
+        unsigned bits = 0;
+        while (pk.value() >> bits) bits++;
+        g = bits < 15 ? 15 - bits : 0;
+    }
+
+    // bit-reversal gather (and window) fused into the 8-point DFT
+    pk = peak();
+    for (unsigned b = 0; b < STRIDE; b++) {
+        T p[MAX_VEC_LEN];
+        for (unsigned i = 0; i < MAX_VEC_LEN; i++) {
+            p[i] = in[bitrev<STRIDE>.data[b] + i * STRIDE];
+            if (window != WINDOW_NONE)
+                p[i] = srs<T>(mul(p[i], cint16{win[id * N_POINT + b * MAX_VEC_LEN + i], 0}), WIN_SHIFT - g);
+        }
+        for (unsigned j = 0; j < MAX_VEC_LEN; j++) {
+            cacc m = mul(mat_omg<MAX_VEC_LEN>.data[j], p[0]);
+            for (unsigned i = 1; i < MAX_VEC_LEN; i++) m = mac(m, mat_omg<MAX_VEC_LEN>.data[i * MAX_VEC_LEN + j], p[i]);
+            y[b * MAX_VEC_LEN + j] = srs<T>(m, MAT_OMG_SHIFT + g + s);
+            pk.update(y[b * MAX_VEC_LEN + j]);
+        }
+    }
+
+    // Stage two reads bin r of the tile for the bins N_POINT*q + r of the band:
+    // a band narrower than N_POINT/2 needs the butterflies from band_lo mod
+    // N_POINT/2 on, as many as it has bins, rounded out to whole vectors
+    unsigned first = 0, count = HALF;
+    if (num_tiles == MAX_TILES && band_hi > band_lo && band_hi - band_lo < (int)N_POINT / 2) {
+        unsigned b = band_lo % (N_POINT / 2);
+        first = b / VEC;
+        count = std::min((b + band_hi - band_lo + VEC - 1) / VEC - first, HALF);
+    }
+
+    unsigned p = pk.value();
+    passes(id, y, p, e, first, count);
+
+    // a single tile is the last stage: out_shift (the exponent with BFP) and the conjugate
+    if (num_tiles == 1) {
+        unsigned o = bfp ? 0 : out_shift;
+        if (bfp) e -= out_shift;
+        for (unsigned i = 0; i < N_POINT; i++) y[i] = conj_if(downshift(y[i], o), inverse);
+    }
+    if (bfp) {
+        y[N_POINT] = trailer0<T>(e, p);
+        for (unsigned i = 1; i < MAX_VEC_LEN; i++) y[N_POINT + i] = {0, 0};
+    }
+}
+
+template<typename T>
+void pipeline<T>::inverse_tile(const T * const *x, T *y) const
+{
+    constexpr unsigned STRIDE = N_POINT / MAX_VEC_LEN, SEG = N_POINT / 4;
+    T in[N_POINT];
+
+    // bfp::align: the slices brought to the largest exponent
+    int e = 0;
+    unsigned d[4] = {};
+    if (bfp) {
+        for (unsigned k = 0; k < 4; k++) e = std::max(e, (int)x[k][SEG].real);
+        for (unsigned k = 0; k < 4; k++) d[k] = e - x[k][SEG].real;
+    }
+    peak pk;
+    for (unsigned i = 0; i < N_POINT; i++) {
+        in[i] = downshift(x[i / SEG][i % SEG], d[i / SEG]);
+        pk.update(in[i]);
+    }
+    unsigned s = shift(pk.value(), 4);
+    e += s;
+
+    // the 8-point DFT reads input j from -j mod N_POINT: the forward
+    // transform of the reversed input is the inverse one
+    pk = peak();
+    for (unsigned b = 0; b < STRIDE; b++) {
+        T p[MAX_VEC_LEN];
+        for (unsigned i = 0; i < MAX_VEC_LEN; i++)
+            p[i] = in[(N_POINT - bitrev<STRIDE>.data[b] - i * STRIDE) % N_POINT];
+        for (unsigned j = 0; j < MAX_VEC_LEN; j++) {
+            cacc m = mul(mat_omg<MAX_VEC_LEN>.data[j], p[0]);
+            for (unsigned i = 1; i < MAX_VEC_LEN; i++) m = mac(m, mat_omg<MAX_VEC_LEN>.data[i * MAX_VEC_LEN + j], p[i]);
+            y[b * MAX_VEC_LEN + j] = srs<T>(m, MAT_OMG_SHIFT + s);
+            pk.update(y[b * MAX_VEC_LEN + j]);
+        }
+    }
+
+    unsigned p = pk.value();
+    passes(0, y, p, e, 0, HALF);
+    if (bfp) {
+        y[N_POINT] = trailer0<T>(e, p);
+        for (unsigned i = 1; i < MAX_VEC_LEN; i++) y[N_POINT + i] = {0, 0};
+    }
+}
+
+template<typename T>
+void pipeline<T>::passes(unsigned id, T *y, unsigned &peak_y, int &e, unsigned first, unsigned count) const
+{
+    T x[N_POINT];
+    peak pk;
+    pk.hi = peak_y;
+    unsigned s;
+
+    // radix-2^2 passes (16,32), (64,128), (256,512): y -> x -> y -> x
+    T *src = y, *dst = x;
+    for (unsigned l = 16; l <= 256; l *= 4) {
+        const cint16 *w = l == 16 ? omg<16>.data : l == 64 ? omg<64>.data : omg<256>.data;
+        const cint16 *w2 = l == 16 ? omg<32>.data : l == 64 ? omg<128>.data : omg<512>.data;
+        unsigned m = l / 2;
+        s = shift(pk.value(), 3);
+        e += s;
+        pk = peak();
+        for (unsigned p = 0; p < N_POINT; p += 2 * l) {
+            for (unsigned i = 0; i < m; i++) {
+                T v_0 = downshift(src[p + i], s), v_1 = src[p + i + m];
+                T v_2 = downshift(src[p + i + 2 * m], s), v_3 = src[p + i + 3 * m];
+                T v_t = srs<T>(mul(w[i], v_1), OMG_SHIFT + s);
+                v_1 = sub(v_0, v_t);
+                v_0 = add(v_0, v_t);
+                v_t = srs<T>(mul(w[i], v_3), OMG_SHIFT + s);
+                v_3 = sub(v_2, v_t);
+                v_2 = add(v_2, v_t);
+                T v_t0 = srs<T>(mul(w2[i], v_2), OMG_SHIFT);
+                T v_t1 = srs<T>(mul(w2[i + m], v_3), OMG_SHIFT);
+                T *q = dst + p + i;
+                q[0] = add(v_0, v_t0);
+                q[m] = add(v_1, v_t1);
+                q[2 * m] = sub(v_0, v_t0);
+                q[3 * m] = sub(v_1, v_t1);
+                for (unsigned k = 0; k < 4; k++) pk.update(q[k * m]);
+            }
+        }
+        std::swap(src, dst);
+    }
+
+    // last radix-2 pass, with the cross twiddles W_N^(id*k) on tiles id != 0;
+    // a band leaves out the butterflies outside vectors first ... first+count-1
+    s = shift(pk.value(), 2);
+    e += s;
+    pk = peak();
+    const cint16 *tf = tw.data() + id * N_POINT;
+    for (unsigned j = 0; j < count; j++) {
+        for (unsigned i = (first + j) % HALF * VEC, end = i + VEC; i < end; i++) {
+            T v_t = srs<T>(mul(omg<1024>.data[i], src[N_POINT / 2 + i]), OMG_SHIFT + s);
+            T v_0 = downshift(src[i], s);
+            T v_1 = sub(v_0, v_t);
+            v_0 = add(v_0, v_t);
+            if (id != 0) {
+                v_0 = srs<T>(mul(v_0, tf[i]), TF_SHIFT);
+                v_1 = srs<T>(mul(v_1, tf[N_POINT / 2 + i]), TF_SHIFT);
+            }
+            y[i] = v_0;
+            y[N_POINT / 2 + i] = v_1;
+            pk.update(v_0);
+            pk.update(v_1);
+        }
+    }
+    peak_y = pk.value();
+}
+
+// bfp::align: d[t] brings tile t to the largest exponent, p is the peak after alignment
+template<typename T>
+static int align(T * const *x, unsigned tiles, unsigned len, bool bfp, unsigned *d, unsigned &p)
+{
+    int e = 0;
+    p = 0;
+    for (unsigned t = 0; t < tiles; t++) d[t] = 0;
+    if (bfp) {
+        for (unsigned t = 0; t < tiles; t++) e = std::max(e, (int)x[t][len].real);
+        for (unsigned t = 0; t < tiles; t++) {
+            d[t] = e - x[t][len].real;
+            p = std::max(p, (unsigned)x[t][len].imag >> d[t]);
+        }
+    }
+    return e;
+}
+
+template<typename T>
+void pipeline<T>::stage2(T * const *x, std::vector<T> *out)
+{
+    // exponent alignment
+    unsigned d[MAX_TILES], p;
+    int e = align(x, num_tiles, N_POINT, bfp, d, p);
+    unsigned s = shift(p, num_tiles == 2 ? 1 : num_tiles == 4 ? 3 : 4);
+    // out_shift: the rounding takes it, or the exponent with BFP
+    unsigned o = bfp ? 0 : out_shift;
+    if (bfp) e -= out_shift;
+    const bool inverse = direction == FFT_INVERSE;
+
+    // Kernel h takes bins h*bins ... of every tile, row q leaves through
+    // output q/rows*kernels+h: its stream q/rows (8 tiles) or window q.
+    const unsigned kernels = num_kernels(), bins = N_POINT / kernels;
+    const unsigned streams = num_outputs() / kernels, rows = num_tiles / streams;
+
+    if (num_tiles == 2) {
+        // plain butterfly, both inputs shifted before the add
+        for (unsigned h = 0; h < kernels; h++) {
+            peak pk;
+            for (unsigned i = h * bins; i < (h + 1) * bins; i++) {
+                T v_0 = downshift(x[0][i], d[0] + s), v_1 = downshift(x[1][i], d[1] + s);
+                T r_0 = conj_if(downshift(add(v_0, v_1), o), inverse);
+                T r_1 = conj_if(downshift(sub(v_0, v_1), o), inverse);
+                out[h].push_back(r_0);
+                out[kernels + h].push_back(r_1);
+                pk.update(r_0);
+                pk.update(r_1);
+            }
+            if (bfp)
+                for (unsigned q = 0; q < 2; q++) push_trailer(out[q * kernels + h], e + s, pk.value());
+        }
+        return;
+    }
+
+    // rows q of the num_tiles-point DFT, len bins at a time
+    const cint16 *w = num_tiles == 4 ? mat_omg<4>.data : mat_omg<8>.data;
+    const unsigned len = num_tiles == MAX_TILES ? 4 : 8;
+    // bin r of row q, before the conjugate
+    auto row = [&](unsigned q, unsigned r) {
+        cacc m = {0, 0};
+        for (unsigned t = 0; t < num_tiles; t++) m = mac(m, w[q * num_tiles + t], downshift(x[t][r], d[t]));
+        return srs<T>(m, MAT_OMG_SHIFT + s + o);
+    };
+    const bool spectrum = num_tiles == MAX_TILES && mode != FFT_OUT_COMPLEX;
+    const bool band = num_tiles == MAX_TILES && (band_lo != 0 || band_hi != (int)size());
+
+    // spectrum_8 with FFT_WELCH: the power of the frames of a mean adds up in
+    // sums, the last of them writes the rows
+    const bool welch = spectrum && average > 1, first = count == 0, emit = !welch || ++count == average;
+    if (welch && emit) count = 0;
+    const float gain = std::ldexp(1.0f, 2 * (e + (int)s)), inv = welch ? 1.0f / average : 1.0f;
+
+    for (unsigned h = 0; h < kernels; h++) {
+        peak pk;
+        if (spectrum) {
+            // power or dB: groups i and i+1 of row q leave together, 8 bins in
+            // the 16 bytes of 4 cint16 (2 cint32) ones
+            float *a = welch ? sums.data() + h * bins * MAX_TILES : nullptr;
+            for (unsigned i = 0; i < bins / len; i += 2) {
+                int16 b[MAX_TILES][8];
+                for (unsigned k = 0; k < 2; k++) {
+                    for (unsigned q = 0; q < MAX_TILES; q++) {
+                        for (unsigned l = 0; l < len; l++) {
+                            T r = row(q, h * bins + (i + k) * len + l);
+                            pk.update(r);
+                            float v = power(r) * gain;
+                            if (welch) {
+                                float &sum = a[((i + k) * MAX_TILES + q) * len + l];
+                                if (!first) v = v + sum;
+                                if (emit) v = v * inv;
+                                else sum = v;
+                            }
+                            b[q][k * len + l] = mode == FFT_OUT_POWER ? bfloat16(v) : decibel(v);
+                        }
+                    }
+                }
+                if (emit)
+                    for (unsigned q = 0; q < MAX_TILES; q++) {
+                        constexpr unsigned n = 8 * sizeof(int16) / sizeof(T);
+                        T v[n];
+                        std::memcpy(v, b[q], sizeof(v));
+                        out[q / rows * kernels + h].insert(out[q / rows * kernels + h].end(), v, v + n);
+                    }
+            }
+        } else if (band) {
+            // band_8: the groups of every row that lie in the band, in natural order
+            for (unsigned q = 0; q < MAX_TILES; q++) {
+                int base = N_POINT * q + h * bins;
+                int lo = band_lo - base, hi = band_hi - base;
+                lo = lo < 0 ? 0 : lo / (int)len;
+                hi = hi > (int)bins ? bins / len : hi / (int)len;
+                for (int i = lo; i < hi; i++) {
+                    for (unsigned l = 0; l < len; l++) {
+                        T r = conj_if(row(q, h * bins + i * len + l), inverse);
+                        out[q / rows * kernels + h].push_back(r);
+                        pk.update(r);
+                    }
+                }
+            }
+        } else {
+            for (unsigned i = 0; i < bins / len; i++) {
+                for (unsigned q = 0; q < num_tiles; q++) {
+                    for (unsigned l = 0; l < len; l++) {
+                        T r = conj_if(row(q, h * bins + i * len + l), inverse);
+                        out[q / rows * kernels + h].push_back(r);
+                        pk.update(r);
+                    }
+                }
+            }
+        }
+        if (bfp && emit)
+            for (unsigned g = 0; g < streams; g++) push_trailer(out[g * kernels + h], e + s, pk.value());
+    }
+}
+
+template<typename T>
+void pipeline<T>::conv_stage2(T * const *x, unsigned h, T * const *z) const
+{
+    const cint16 *w = mat_omg<8>.data;
+    // the slice trailers repeat the tile's
+    unsigned d[MAX_TILES], p;
+    int e = align(x, MAX_TILES, N_POINT, bfp, d, p);
+    unsigned s = shift(p, 4);
+    peak py, pk;
+
+    // forward 8-point stage and the product with the filter, row q in z[q]
+    for (unsigned j = 0; j < CONV_BINS; j++) {
+        unsigned r = h * CONV_BINS + j;
+        for (unsigned q = 0; q < MAX_TILES; q++) {
+            cacc m = {0, 0};
+            for (unsigned t = 0; t < MAX_TILES; t++) m = mac(m, w[q * MAX_TILES + t], downshift(x[t][r], d[t]));
+            z[q][j] = srs<T>(mul(srs<T>(m, MAT_OMG_SHIFT + s), filter[N_POINT * q + r]), filter_shift);
+            py.update(z[q][j]);
+        }
+    }
+    unsigned g = shift(py.value(), 4);
+
+    // inverse 8-point stage: row t is the forward row -t, then the cross
+    // twiddles W_N^(-t*r) of inverse tile t
+    for (unsigned j = 0; j < CONV_BINS; j++) {
+        T u[MAX_TILES];
+        for (unsigned q = 0; q < MAX_TILES; q++) u[q] = z[q][j];
+        for (unsigned t = 0; t < MAX_TILES; t++) {
+            cacc m = {0, 0};
+            for (unsigned q = 0; q < MAX_TILES; q++) m = mac(m, w[(MAX_TILES - t) % MAX_TILES * MAX_TILES + q], u[q]);
+            T r = srs<T>(m, MAT_OMG_SHIFT + g);
+            if (t != 0) r = srs<T>(mul(r, itw[t * N_POINT + h * CONV_BINS + j]), TF_SHIFT);
+            z[t][j] = r;
+            pk.update(r);
+        }
+    }
+    if (bfp)
+        for (unsigned t = 0; t < MAX_TILES; t++) {
+            z[t][CONV_BINS] = trailer0<T>(e + s + g, pk.value());
+            for (unsigned i = 1; i < MAX_VEC_LEN; i++) z[t][CONV_BINS + i] = {0, 0};
+        }
+}
+
+template<typename T>
+int pipeline<T>::run(const T *x, std::vector<T> *out)
+{
+    const unsigned W = N_POINT + (bfp ? MAX_VEC_LEN : 0);
+    std::vector<T> in(N_POINT), y(num_tiles * (N_POINT + MAX_VEC_LEN));
+    T *yt[MAX_TILES];
+    for (unsigned q = 0; q < num_outputs(); q++) {
+        out[q].clear();
+        out[q].reserve(size() / num_outputs() + MAX_VEC_LEN);
+    }
+    for (unsigned t = 0; t < num_tiles; t++) {
+        yt[t] = y.data() + t * (N_POINT + MAX_VEC_LEN);
+        tile_input(x, t, in.data());
+        tile(t, in.data(), yt[t]);
+    }
+    if (!filter.empty()) {
+        // conv_stage2<h> hands row t of its slice to inverse tile t
+        std::vector<T> z(CONV_SLICES * MAX_TILES * (CONV_BINS + MAX_VEC_LEN));
+        auto slice = [&](unsigned h, unsigned t) { return z.data() + (h * MAX_TILES + t) * (CONV_BINS + MAX_VEC_LEN); };
+        for (unsigned h = 0; h < CONV_SLICES; h++) {
+            T *zh[MAX_TILES];
+            for (unsigned t = 0; t < MAX_TILES; t++) zh[t] = slice(h, t);
+            conv_stage2(yt, h, zh);
+        }
+        for (unsigned t = 0; t < MAX_TILES; t++) {
+            const T *zt[CONV_SLICES];
+            for (unsigned h = 0; h < CONV_SLICES; h++) zt[h] = slice(h, t);
+            out[t].resize(N_POINT + MAX_VEC_LEN);
+            inverse_tile(zt, out[t].data());
+            out[t].resize(W);
+        }
+    } else if (num_tiles == 1) {
+        out[0].assign(yt[0], yt[0] + W);
+    } else {
+        stage2(yt, out);
+    }
+    return bfp && !out[0].empty() ? out[0][out[0].size() - MAX_VEC_LEN].real : 0;
+}
+
+template<typename T>
+void pipeline<T>::spectrum(const std::vector<T> *out, int e, std::complex<double> *X) const
+{
+    double scale = std::ldexp(1.0, e);
+    const unsigned n = size();
+    for (unsigned j = 0; j < n; j++) {
+        unsigned k;
+        T v;
+        if (num_tiles == MAX_TILES) {
+            // position 4(R*i+q)+l of stream g of kernel h holds bin
+            // 4i+l+h*bins+N_POINT*(g*R+q), R rows per stream
+            const unsigned kernels = num_kernels(), bins = N_POINT / kernels;
+            const unsigned len = n / num_outputs(), R = MAX_TILES * kernels / num_outputs();
+            unsigned o = j / len, p = j % len, g = o / kernels, h = o % kernels;
+            unsigned i = p / (4 * R), q = (p / 4) % R, l = p % 4;
+            k = 4 * i + l + h * bins + N_POINT * (g * R + q);
+            v = out[o][p];
+        } else {
+            // window q of kernel h holds bins N_POINT*q+h*bins ...
+            const unsigned bins = N_POINT / num_kernels();
+            k = j;
+            v = out[j / N_POINT * num_kernels() + j % N_POINT / bins][j % bins];
+        }
+        X[k] = std::complex<double>(v.real, v.imag) * scale;
+    }
+}
+
+// ------------------------------reference------------------------------
+
+reference::reference(unsigned n) : n(n), rev(n), w(n / 2)
+{
+    unsigned bits = 0;
+    while ((1u << bits) < n) bits++;
+    for (unsigned i = 0; i < n; i++) {
+        unsigned r = 0;
+        for (unsigned b = 0; b < bits; b++)
+            if ((i >> b) & 1) r |= 1u << (bits - 1 - b);
+        rev[i] = r;
+    }
+    for (unsigned k = 0; k < n / 2; k++) w[k] = std::polar(1.0, -2 * M_PI * k / n);
+}
+
+void reference::run(const std::complex<double> *x, std::complex<double> *X) const
+{
+    for (unsigned i = 0; i < n; i++) X[rev[i]] = x[i];
+    for (unsigned l = 2; l <= n; l *= 2) {
+        unsigned step = n / l;
+        for (unsigned p = 0; p < n; p += l) {
+            for (unsigned k = 0; k < l / 2; k++) {
+                std::complex<double> t = w[k * step] * X[p + k + l / 2];
+                X[p + k + l / 2] = X[p + k] - t;
+                X[p + k] += t;
+            }
+        }
+    }
+}
+
+accuracy compare(const std::complex<double> *ref, const std::complex<double> *X, unsigned n)
+{
+    double sig = 0, err = 0, max_err = 0;
+    for (unsigned k = 0; k < n; k++) {
+        std::complex<double> d = X[k] - ref[k];
+        sig += std::norm(ref[k]);
+        err += std::norm(d);
+        max_err = std::max(max_err, std::max(std::fabs(d.real()), std::fabs(d.imag())));
+    }
+    return {10 * std::log10(sig / std::max(err, 1e-300)), max_err};
+}
+
+template class pipeline<cint16>;
+template class pipeline<cint32>;
+
+} // namespace fft_model
@@ -0,0 +1,152 @@
+#pragma once
+
+// Bit-exact host model of the fixed-point AIE pipeline, cint16 and cint32
+// samples: the radix2_dit stage-one tiles and the 2/4/8-point stage two (and
+// the inverse tile of the convolution graph), with the same twiddle tables,
+// the same floor shifts and the same 16/32-bit wraparound the tiles run with
+// (no rounding or saturation mode is set). cfloat is left out, its results
+// follow the accumulation order of the vector unit. The block-floating-point
+// build (FFT_BFP, cint16 only) is modelled as well,
+// trailers included, and so are the window, direction and out_shift RTPs,
+// the band and output_mode/average RTPs of the 8-point stage two (Welch as
+// in a FFT_WELCH build) and the middle of the convolution graph.
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+// host stand-ins for the AIE element types the shared tables are written against
+typedef int16_t int16;
+typedef int32_t int32;
+struct cint16 { int16 real, imag; };
+struct cint32 { int32 real, imag; };
+struct cfloat { float real, imag; };
+
+#include "definition.hpp"
+
+namespace fft_model {
+
+// T: the sample type, cint16 or cint32 (FFT_DTYPE)
+template<typename T>
+class pipeline {
+public:
+    // num_tiles stage-one tiles of N_POINT points, bfp: model the FFT_BFP build,
+    // out_streams: FFT_OUT_STREAMS of an 8-tile graph, window: the WINDOW_* RTP,
+    // direction: FFT_FORWARD/INVERSE, out_shift: right shift of the result
+    explicit pipeline(unsigned num_tiles, bool bfp=false, unsigned out_streams=1, int window=WINDOW_NONE,
+                      int direction=FFT_FORWARD, unsigned out_shift=0);
+
+    // band_lo, band_hi RTPs of an 8-tile graph: only the bins lo ... hi-1
+    // (multiples of 4), 0 and size() for the whole spectrum
+    void set_band(int lo, int hi);
+    // output_mode (FFT_OUT_*) and average RTPs of an 8-tile graph; average > 1
+    // models a FFT_WELCH build: run() keeps the power sums and only every
+    // average-th frame writes its rows. Restarts the mean, as a change does.
+    void set_output(int mode, int average=1);
+    // the convolution graph instead (8 tiles, no other RTPs): filter holds the
+    // size() bins of H in natural order, shift the product shift
+    void set_filter(const cint16 *filter, unsigned shift);
+
+    unsigned size() const { return num_tiles * N_POINT; }
+    // stage-two kernels, each on a slice of the bins with its own BFP peak:
+    // S2_SLICES, a cint32 stage two never runs fewer than SPLIT
+    unsigned num_kernels() const
+    {
+        if (num_tiles == 1) return 1;
+        if (num_tiles != MAX_TILES) return SPLIT;
+        return std::max(SPLIT, out_streams / 2);
+    }
+    // output PLIOs of the graph: the streams (8 tiles) or one window per row
+    // of every kernel, one window per inverse tile for the convolution graph
+    unsigned num_outputs() const
+    {
+        if (!filter.empty()) return MAX_TILES;
+        if (num_tiles == 1) return 1;
+        if (num_tiles != MAX_TILES) return num_tiles * SPLIT;
+        return std::max(out_streams, num_kernels());
+    }
+
+    // One frame. x: size() samples in natural order. out[q] receives what
+    // DataOutFFT<q> carries for the frame, trailer included: nothing for the
+    // frames a Welch mean holds back, power and dB as pairs of 16-bit bins.
+    // Returns the block exponent (0 without BFP or output). Not const: the
+    // Welch sums carry over to the next frame, so one pipeline per thread.
+    int run(const T *x, std::vector<T> *out);
+
+    // natural-order spectrum of run()'s outputs (complex, whole band), scaled by 2^exponent
+    void spectrum(const std::vector<T> *out, int e, std::complex<double> *X) const;
+
+    // PLIO DataInFFT<id>: the stride-num_tiles subsequence tile id consumes
+    void tile_input(const T *x, unsigned id, T *in) const;
+
+    // radix2_dit<id, num_tiles>; y gets N_POINT samples plus the BFP trailer
+    void tile(unsigned id, const T *in, T *y) const;
+
+    // radix2_dit_inverse4 of the convolution graph: N_POINT * IDFT of the
+    // N_POINT bins in the four slices x[0] ... x[3], each of N_POINT/4 bins
+    // followed by its own BFP trailer (the conv_stage2 kernels pick their
+    // exponents apart); y as for tile()
+    void inverse_tile(const T * const *x, T *y) const;
+
+private:
+    // S2_SPLIT: slices of a cint32 stage two; VEC_LEN: lanes of the last
+    // pass, HALF: its butterflies in vectors
+    static constexpr unsigned SPLIT = sizeof(T) / sizeof(cint16);
+    static constexpr unsigned VEC = 128 / sizeof(T), HALF = N_POINT / 2 / VEC;
+
+    unsigned num_tiles;
+    bool bfp;
+    unsigned out_streams;
+    int window;
+    int direction;
+    unsigned out_shift;
+    int band_lo, band_hi;
+    int mode = FFT_OUT_COMPLEX;
+    int average = 1;
+    int count = 0;                // frames in the Welch sums
+    std::vector<float> sums;      // Welch sums of every kernel, in the order its bins leave
+    std::vector<cint16> tw;       // cross twiddles of every tile, tf<N, id>
+    std::vector<int16> win;       // window of every tile in gather order, win<N, id, window>
+    std::vector<cint16> filter;   // conv_stage2 filter, natural order
+    std::vector<cint16> itw;      // inverse cross twiddles of every row, tf<N, N-t>
+    unsigned filter_shift = 0;
+
+    unsigned shift(unsigned peak, unsigned growth) const;
+    // the passes after the 8-point DFT, y in place: peak_y is the peak of y,
+    // e the exponent so far, both updated; tile id applies its cross twiddles.
+    // The last pass computes count vectors of butterflies from vector first on.
+    void passes(unsigned id, T *y, unsigned &peak_y, int &e, unsigned first, unsigned count) const;
+    // advances the Welch mean
+    void stage2(T * const *x, std::vector<T> *out);
+    // conv_stage2<h>: z[q] gets row q of the slice plus the BFP trailer
+    void conv_stage2(T * const *x, unsigned h, T * const *z) const;
+};
+
+// double-precision FFT of n (a power of two) samples, the accuracy reference
+class reference {
+public:
+    explicit reference(unsigned n);
+    template<typename T>
+    void run(const T *x, std::complex<double> *X) const
+    {
+        std::vector<std::complex<double>> v(n);
+        for (unsigned i = 0; i < n; i++) v[i] = std::complex<double>(x[i].real, x[i].imag);
+        run(v.data(), X);
+    }
+    void run(const std::complex<double> *x, std::complex<double> *X) const;
+
+private:
+    unsigned n;
+    std::vector<unsigned> rev;             // bit-reversed input order
+    std::vector<std::complex<double>> w;   // W_n^k for k < n/2
+};
+
+struct accuracy {
+    double snr_db;   // signal to error power of the whole frame
+    double max_err;  // largest |Re|/|Im| error
+};
+
+accuracy compare(const std::complex<double> *ref, const std::complex<double> *X, unsigned n);
+
+} // namespace fft_model
@@ -0,0 +1,366 @@
+// Command line front end of the bit-exact model.
+//
+// Accuracy run: random and tone frames through the model, checked against a
+// double-precision FFT:
+//     fft_model -n 8192 [-type cint16] [-bfp] [-frames 1000000] [-amp 64] [-signal mix] [-j 16]
+// -type cint32 models the DTYPE=cint32 build (no BFP, amplitudes up to 2^27).
+// -window hann|blackman models the window RTP (the reference FFT takes the
+// exactly windowed signal) in either mode, -inverse and -shift S the direction
+// and out_shift RTPs (the reference is then n * IDFT, scaled by 2^-S).
+// AIE comparison: model output against what the graph produced for the same input:
+//     fft_model -n 8192 [-bfp] [-streams S] -in DataInFFT0.txt [...] -out DataOutFFT0.txt [...]
+// -in takes one file per stage-one tile, or one file holding all tiles one
+// after the other (the host/mm2s layout), as many frames as the files hold;
+// -out takes the DataOutFFT<q> files, one per output stream of an 8K graph
+// built with OUT_STREAMS=S. The RTPs of the 8K graph graph.cpp sets:
+// -band LO HI the band, -mode power|db and -average A the output_mode and
+// average (a Welch build, OUTPUT_MODE/AVERAGE of the AIE Makefile); -conv the
+// convolution graph (CONV=1) with the pass filter graph.cpp loads, or
+// -filter F (the 8K bins of H in natural order) and -filter_shift S.
+// Inverse-tile run: the radix2_dit_inverse4 tile of the convolution graph on
+// random spectra whose four slices carry exponents up to 3 apart (-bfp), as the
+// conv_stage2 kernels hand them over, checked against n * IDFT:
+//     fft_model -slices [-type T] [-bfp] [-frames 1000] [-amp 64] [-seed S]
+
+#include "fft_model.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace fft_model;
+
+static void usage()
+{
+    std::cerr << "usage: fft_model [-n points] [-type T] [-bfp] [-window W] [-inverse] [-shift S] [-frames F] [-amp A]\n"
+                 "                 [-signal noise|tone|mix] [-seed S] [-j threads]\n"
+                 "       fft_model [-n points] [-type T] [-bfp] [-window W] [-inverse] [-shift S] [-streams S] [-band LO HI]\n"
+                 "                 [-mode complex|power|db] [-average A] [-conv] [-filter F] [-filter_shift S]\n"
+                 "                 -in file... -out file...\n"
+                 "       fft_model -slices [-type T] [-bfp] [-frames F] [-amp A] [-seed S]\n";
+}
+
+// samples of a simulator or host text file; skips the simulator's time stamps and TLAST marks
+template<typename T>
+static std::vector<T> read_samples(const std::string &name)
+{
+    std::ifstream f(name);
+    if (!f) {
+        std::cerr << "cannot open " << name << std::endl;
+        exit(1);
+    }
+    std::vector<long> v;
+    std::string tok;
+    while (f >> tok) {
+        if (tok == "T") { f >> tok >> tok; continue; }
+        if (tok == "TLAST") continue;
+        v.push_back(std::stol(tok));
+    }
+    typedef decltype(T::real) part;
+    std::vector<T> s(v.size() / 2);
+    for (size_t i = 0; i < s.size(); i++) s[i] = {(part)v[2 * i], (part)v[2 * i + 1]};
+    return s;
+}
+
+template<typename T>
+static int compare_aie(pipeline<T> &model, const std::vector<std::string> &in, const std::vector<std::string> &out)
+{
+    const unsigned n = model.size(), tiles = n / N_POINT;
+    // frame f, tile t at [(f*tiles+t)*N_POINT, ...) of the concatenated tile streams
+    std::vector<T> s;
+    size_t frames = 0;
+    if (in.size() == 1) {
+        s = read_samples<T>(in[0]);
+        frames = s.size() / n;
+    } else if (in.size() == tiles) {
+        std::vector<std::vector<T>> st(tiles);
+        frames = SIZE_MAX;
+        for (unsigned t = 0; t < tiles; t++) {
+            st[t] = read_samples<T>(in[t]);
+            frames = std::min(frames, st[t].size() / N_POINT);
+        }
+        s.resize(frames * n);
+        for (size_t f = 0; f < frames; f++)
+            for (unsigned t = 0; t < tiles; t++)
+                std::copy_n(st[t].begin() + f * N_POINT, N_POINT, s.begin() + (f * tiles + t) * N_POINT);
+    } else {
+        std::cerr << "-in takes 1 or " << tiles << " files" << std::endl;
+        return 1;
+    }
+    if (!frames) { std::cerr << "-in: " << s.size() << " samples, need " << n << " a frame" << std::endl; return 1; }
+    if (out.size() != model.num_outputs()) {
+        std::cerr << "-out takes " << model.num_outputs() << " file(s)" << std::endl;
+        return 1;
+    }
+
+    // what the graph sends for all the frames, one after the other
+    std::vector<T> x(n);
+    std::vector<std::vector<T>> y(model.num_outputs()), yf(model.num_outputs());
+    for (size_t f = 0; f < frames; f++) {
+        for (unsigned t = 0; t < tiles; t++)
+            for (unsigned m = 0; m < N_POINT; m++) x[tiles * m + t] = s[(f * tiles + t) * N_POINT + m];
+        model.run(x.data(), yf.data());
+        for (unsigned q = 0; q < y.size(); q++) y[q].insert(y[q].end(), yf[q].begin(), yf[q].end());
+    }
+
+    size_t mismatches = 0, total = 0, first = SIZE_MAX;
+    long max_diff = 0;
+    for (unsigned q = 0; q < out.size(); q++) {
+        auto aie = read_samples<T>(out[q]);
+        if (aie.size() < y[q].size()) {
+            std::cerr << out[q] << ": " << aie.size() << " samples, need " << y[q].size() << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < y[q].size(); i++, total++) {
+            long d = std::max(std::abs((long)aie[i].real - y[q][i].real), std::abs((long)aie[i].imag - y[q][i].imag));
+            if (d) {
+                mismatches++;
+                if (first == SIZE_MAX) first = total;
+            }
+            max_diff = std::max(max_diff, d);
+        }
+    }
+    std::cout << "compared " << total << " samples of " << frames << " frame(s): " << mismatches << " mismatches, max difference " << max_diff;
+    if (mismatches) std::cout << ", first at " << first;
+    std::cout << std::endl;
+    return mismatches ? 2 : 0;
+}
+
+template<typename T>
+static int run_slices(bool bfp, long frames, double amp, unsigned seed)
+{
+    constexpr unsigned SEG = N_POINT / 4;
+    typedef decltype(T::real) part;
+    pipeline<T> model(1, bfp);
+    std::vector<T> x[4], y(N_POINT + MAX_VEC_LEN);
+    for (auto &v : x) v.resize(SEG + MAX_VEC_LEN);
+    const T *slices[4] = {x[0].data(), x[1].data(), x[2].data(), x[3].data()};
+    std::vector<std::complex<double>> z(N_POINT), ref(N_POINT), X(N_POINT);
+    reference fft(N_POINT);
+    double sum_snr = 0, min_snr = INFINITY, err = 0;
+    long worst = -1;
+
+    for (long f = 0; f < frames; f++) {
+        std::mt19937 rng(seed + f);
+        std::uniform_real_distribution<double> u(-amp, amp);
+        for (unsigned h = 0; h < 4; h++) {
+            // slice h holds the bins at exponent e_h: v = floor(bin / 2^e_h)
+            int e_h = bfp ? rng() % 4 : 0;
+            unsigned p = 0;
+            for (unsigned i = 0; i < SEG; i++) {
+                T v = {(part)(std::lround(u(rng)) >> e_h), (part)(std::lround(u(rng)) >> e_h)};
+                x[h][i] = v;
+                z[h * SEG + i] = std::complex<double>(v.real, v.imag) * std::ldexp(1.0, e_h);
+                p = std::max({p, (unsigned)std::abs(v.real), (unsigned)std::abs(v.imag)});
+            }
+            x[h][SEG] = {(part)e_h, (part)p};
+        }
+        model.inverse_tile(slices, y.data());
+        int e = bfp ? y[N_POINT].real : 0;
+        for (unsigned i = 0; i < N_POINT; i++)
+            X[i] = std::complex<double>(y[i].real, y[i].imag) * std::ldexp(1.0, e);
+        // n * IDFT(z) = conj(DFT(conj(z)))
+        for (auto &v : z) v = std::conj(v);
+        fft.run(z.data(), ref.data());
+        for (auto &v : ref) v = std::conj(v);
+        accuracy acc = compare(ref.data(), X.data(), N_POINT);
+        sum_snr += acc.snr_db;
+        if (acc.snr_db < min_snr) { min_snr = acc.snr_db; worst = f; }
+        err = std::max(err, acc.max_err);
+    }
+    std::cout << frames << " inverse tiles (amplitude " << amp << (bfp ? ", bfp" : "") << ")" << std::endl;
+    std::cout << "SNR mean " << sum_snr / frames << " dB, min " << min_snr
+              << " dB (frame " << worst << ", -seed " << seed + worst << ")" << std::endl;
+    std::cout << "max error " << err << std::endl;
+    return 0;
+}
+
+// the command line, as main() parses it
+struct options {
+    unsigned n = 8192, threads = std::max(1u, std::thread::hardware_concurrency());
+    bool bfp = false, inverse = false, conv = false;
+    unsigned out_shift = 0;
+    long frames = 10000;
+    double amp = 64;
+    std::string signal = "mix", window = "none", mode = "complex", filter;
+    unsigned seed = 1, streams = 1, average = 1;
+    int kind = WINDOW_NONE;
+    int band_lo = 0, band_hi = -1, filter_shift = -1;
+    bool whole = true;
+    std::vector<std::string> in, out;
+};
+
+template<typename T>
+static int run_model(const options &o)
+{
+    typedef decltype(T::real) part;
+    const unsigned n = o.n;
+    pipeline<T> model(n / N_POINT, o.bfp, o.streams, o.kind, o.inverse ? FFT_INVERSE : FFT_FORWARD, o.out_shift);
+    model.set_band(o.band_lo, o.band_hi);
+    model.set_output(o.mode == "power" ? FFT_OUT_POWER : o.mode == "db" ? FFT_OUT_DB : FFT_OUT_COMPLEX, o.average);
+    if (o.conv) {
+        // graph.cpp passes the signal: H = 1 in Q14 with the 1/N of the unscaled inverse
+        std::vector<cint16> H(n, cint16{1 << 14, 0});
+        if (!o.filter.empty()) {
+            H = read_samples<cint16>(o.filter);
+            if (H.size() != n) { std::cerr << o.filter << ": " << H.size() << " bins, need " << n << std::endl; return 1; }
+        }
+        model.set_filter(H.data(), o.filter_shift >= 0 ? o.filter_shift : o.bfp ? 14 : 14 + 13);
+    }
+
+    if (!o.in.empty() || !o.out.empty()) return compare_aie(model, o.in, o.out);
+    if (!o.whole) {
+        std::cerr << "the accuracy run checks the whole complex spectrum, compare the others with -in/-out" << std::endl;
+        return 1;
+    }
+
+    // Frame f is generated from seed+f alone, so any frame can be reproduced
+    // with -seed <seed+f> -frames 1 whatever the thread count.
+    std::atomic<long> next(0);
+    std::vector<double> sum_snr(o.threads, 0), min_snr(o.threads, INFINITY), max_err(o.threads, 0);
+    std::vector<long> worst(o.threads, -1), overflow(o.threads, 0);
+    auto worker = [&](unsigned id) {
+        pipeline<T> m = model;
+        std::vector<T> x(n);
+        std::vector<std::complex<double>> ref(n), X(n), xw(n);
+        std::vector<std::vector<T>> y(model.num_outputs());
+        reference fft(n);
+        for (long f; (f = next++) < o.frames;) {
+            std::mt19937 rng(o.seed + f);
+            std::uniform_real_distribution<double> u(-o.amp, o.amp);
+            bool tone = o.signal == "tone" || (o.signal == "mix" && ((o.seed + f) & 1));
+            if (tone) {
+                double k = std::uniform_real_distribution<double>(0, n)(rng);
+                double phase = std::uniform_real_distribution<double>(0, 2 * M_PI)(rng);
+                for (unsigned i = 0; i < n; i++) {
+                    double a = 2 * M_PI * k * i / n + phase;
+                    x[i] = {(part)std::lround(o.amp * std::cos(a)), (part)std::lround(o.amp * std::sin(a))};
+                }
+            } else {
+                for (auto &v : x) v = {(part)std::lround(u(rng)), (part)std::lround(u(rng))};
+            }
+            int e = m.run(x.data(), y.data());
+            m.spectrum(y.data(), e, X.data());
+            for (unsigned i = 0; i < n; i++)
+                xw[i] = std::complex<double>(x[i].real, x[i].imag) * fft_tables::window(o.kind, i, n);
+            // n * IDFT(x) = conj(DFT(conj(x)))
+            if (o.inverse)
+                for (auto &v : xw) v = std::conj(v);
+            fft.run(xw.data(), ref.data());
+            for (auto &v : ref) v = (o.inverse ? std::conj(v) : v) * std::ldexp(1.0, -(int)o.out_shift);
+            accuracy acc = compare(ref.data(), X.data(), n);
+
+            sum_snr[id] += acc.snr_db;
+            if (acc.snr_db < min_snr[id]) { min_snr[id] = acc.snr_db; worst[id] = f; }
+            max_err[id] = std::max(max_err[id], acc.max_err);
+            // an error of a quarter of full scale can only come from wraparound
+            if (acc.max_err > std::ldexp(1.0, 8 * sizeof(part) - 3 + e)) overflow[id]++;
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < o.threads; t++) pool.emplace_back(worker, t);
+    for (auto &t : pool) t.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    unsigned w = std::min_element(min_snr.begin(), min_snr.end()) - min_snr.begin();
+    double total_snr = 0, err = 0;
+    long ovf = 0;
+    for (unsigned t = 0; t < o.threads; t++) {
+        total_snr += sum_snr[t];
+        err = std::max(err, max_err[t]);
+        ovf += overflow[t];
+    }
+    std::cout << o.frames << " frames of " << n << " points (" << o.signal << ", amplitude " << o.amp
+              << (sizeof(T) != sizeof(cint16) ? ", cint32" : "") << (o.bfp ? ", bfp" : "") << (o.kind != WINDOW_NONE ? ", " + o.window : "")
+              << (o.inverse ? ", inverse" : "") << (o.out_shift ? ", shift " + std::to_string(o.out_shift) : "") << ") in " << seconds << " s, "
+              << (long)(o.frames / seconds * 60) << " frames/min" << std::endl;
+    std::cout << "SNR mean " << total_snr / o.frames << " dB, min " << min_snr[w]
+              << " dB (frame " << worst[w] << ", -seed " << o.seed + worst[w] << ")" << std::endl;
+    std::cout << "max error " << err << ", frames with overflow " << ovf << std::endl;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    options o;
+    bool slices = false;
+    std::string type = "cint16";
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-in" || a == "-out") {
+            auto &files = a == "-in" ? o.in : o.out;
+            while (i + 1 < argc && argv[i + 1][0] != '-') files.push_back(argv[++i]);
+        }
+        else if (a == "-bfp") o.bfp = true;
+        else if (a == "-inverse") o.inverse = true;
+        else if (a == "-slices") slices = true;
+        else if (a == "-conv") o.conv = true;
+        else if (i + 1 == argc) { usage(); return 1; }
+        else if (a == "-band" && i + 2 < argc) {
+            o.band_lo = std::stoi(argv[++i]);
+            o.band_hi = std::stoi(argv[++i]);
+        }
+        else if (a == "-n") o.n = std::stoul(argv[++i]);
+        else if (a == "-type") type = argv[++i];
+        else if (a == "-frames") o.frames = std::stol(argv[++i]);
+        else if (a == "-amp") o.amp = std::stod(argv[++i]);
+        else if (a == "-signal") o.signal = argv[++i];
+        else if (a == "-seed") o.seed = std::stoul(argv[++i]);
+        else if (a == "-j") o.threads = std::stoul(argv[++i]);
+        else if (a == "-streams") o.streams = std::stoul(argv[++i]);
+        else if (a == "-window") o.window = argv[++i];
+        else if (a == "-shift") o.out_shift = std::stoul(argv[++i]);
+        else if (a == "-mode") o.mode = argv[++i];
+        else if (a == "-average") o.average = std::stoul(argv[++i]);
+        else if (a == "-filter") { o.filter = argv[++i]; o.conv = true; }
+        else if (a == "-filter_shift") o.filter_shift = std::stoi(argv[++i]);
+        else { usage(); return 1; }
+    }
+    if (type != "cint16" && type != "cint32") {
+        std::cerr << "-type takes cint16 or cint32" << std::endl;
+        return 1;
+    }
+    bool wide = type == "cint32";
+    if (wide && o.bfp) {
+        std::cerr << "block floating point is a cint16 mode" << std::endl;
+        return 1;
+    }
+    if (slices) return wide ? run_slices<cint32>(o.bfp, o.frames, o.amp, o.seed) : run_slices<cint16>(o.bfp, o.frames, o.amp, o.seed);
+    const unsigned n = o.n;
+    if (n % N_POINT || (n / N_POINT != 1 && n / N_POINT != 2 && n / N_POINT != 4 && n / N_POINT != MAX_TILES)) {
+        std::cerr << "points must be 1024, 2048, 4096 or 8192" << std::endl;
+        return 1;
+    }
+    if (o.signal != "noise" && o.signal != "tone" && o.signal != "mix") { usage(); return 1; }
+    if (o.streams != 1 && o.streams != 2 && o.streams != 4 && o.streams != MAX_TILES) {
+        std::cerr << "streams must be 1, 2, 4 or 8" << std::endl;
+        return 1;
+    }
+    if (o.window != "none" && o.window != "hann" && o.window != "blackman") { usage(); return 1; }
+    o.kind = o.window == "hann" ? WINDOW_HANN : o.window == "blackman" ? WINDOW_BLACKMAN : WINDOW_NONE;
+    if (o.mode != "complex" && o.mode != "power" && o.mode != "db") { usage(); return 1; }
+    if (o.band_hi < 0) o.band_hi = n;
+    o.whole = o.band_lo == 0 && o.band_hi == (int)n && o.mode == "complex" && o.average == 1 && !o.conv;
+    if (!o.whole && n != MAX_TILES * N_POINT) {
+        std::cerr << "-band, -mode, -average and -conv model the 8K graph" << std::endl;
+        return 1;
+    }
+    if (o.band_lo < 0 || o.band_hi > (int)n || o.band_lo >= o.band_hi || o.band_lo % 4 || o.band_hi % 4) {
+        std::cerr << "the band takes multiples of 4 in [0, " << n << "]" << std::endl;
+        return 1;
+    }
+    if (o.average < 1 || (o.average > 1 && o.streams != MAX_TILES)) {
+        std::cerr << "Welch averaging runs with -streams 8" << std::endl;
+        return 1;
+    }
+    return wide ? run_model<cint32>(o) : run_model<cint16>(o);
+}
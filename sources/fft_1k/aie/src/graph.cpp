@@ -2,13 +2,36 @@
 #include <aie_api/utils.hpp>
 #include <cstdio>
 
-main_graph g;
+#ifndef ITERATIONS
+#define ITERATIONS 1
+#endif
+
+// WINDOW_NONE/HANN/BLACKMAN, the value of the window RTP in simulation
+#ifndef WINDOW
+#define WINDOW WINDOW_NONE
+#endif
+
+// FFT_FORWARD/INVERSE and the output shift of the simulated graph
+#ifndef DIRECTION
+#define DIRECTION FFT_FORWARD
+#endif
+#ifndef OUT_SHIFT
+#define OUT_SHIFT 0
+#endif
+
+fft_1k_graph g;
 
 #if defined(__AIESIM__) || defined(__X86SIM__)
 
 int main(int argc,char** argv){
     g.init();
-    g.run(1);
+    g.update(g.window_type,WINDOW);
+    g.update(g.direction,DIRECTION);
+    g.update(g.out_shift,OUT_SHIFT);
+    // only the 8K graph narrows the spectrum to a band
+    g.update(g.band_lo,0);
+    g.update(g.band_hi,N_POINT);
+    g.run(ITERATIONS);
     g.end();
     return 0;
 }
@@ -1,3 +0,0 @@
-#define N_POINT 1024
-#define MAX_VEC_LEN 8
-#define MAX_VEC_LEN_HALF 4
\ No newline at end of file
@@ -1,8 +0,0 @@
-#pragma once
-
-#define N_POINT 1024
-#define MAX_VEC_LEN 8
-#define MAX_VEC_LEN_HALF 4
-#define MAT_OMG_SHIFT 14
-
-static cint16 mat_omg_8[64]={{16384,0},{16384,0},{16384,0},{16384,0},{16384,0},{16384,0},{16384,0},{16384,0},{16384,0},{11585,-11585},{0,-16384},{-11585,-11585},{-16384,0},{-11585,11585},{0,16384},{11585,11585},{16384,0},{0,-16384},{-16384,0},{0,16384},{16384,0},{0,-16384},{-16384,0},{0,16384},{16384,0},{-11585,-11585},{0,16384},{11585,-11585},{-16384,0},{11585,11585},{0,-16384},{-11585,11585},{16384,0},{-16384,0},{16384,0},{-16384,0},{16384,0},{-16384,0},{16384,0},{-16384,0},{16384,0},{-11585,11585},{0,-16384},{11585,11585},{-16384,0},{11585,-11585},{0,16384},{-11585,-11585},{16384,0},{0,16384},{-16384,0},{0,-16384},{16384,0},{0,16384},{-16384,0},{0,-16384},{16384,0},{11585,11585},{0,16384},{-11585,11585},{-16384,0},{-11585,-11585},{0,-16384},{11585,-11585},};
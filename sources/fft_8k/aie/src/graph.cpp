@@ -1,12 +1,93 @@
 #include "graph.h"
 
-fft_4k_graph g;
+#ifndef ITERATIONS
+#define ITERATIONS 1
+#endif
+
+// WINDOW_NONE/HANN/BLACKMAN, the value of the window RTP in simulation
+#ifndef WINDOW
+#define WINDOW WINDOW_NONE
+#endif
+
+// FFT_FORWARD/INVERSE and the output shift of the simulated graph
+#ifndef DIRECTION
+#define DIRECTION FFT_FORWARD
+#endif
+#ifndef OUT_SHIFT
+#define OUT_SHIFT 0
+#endif
+
+// FFT_OUT_COMPLEX/POWER/DB and the frames averaged per output (FFT_WELCH)
+#ifndef OUTPUT_MODE
+#define OUTPUT_MODE FFT_OUT_COMPLEX
+#endif
+#ifndef AVERAGE
+#define AVERAGE 1
+#endif
+
+// the bins BAND_LO ... BAND_HI-1 of the simulated spectrum, all by default
+#ifndef BAND_LO
+#define BAND_LO 0
+#endif
+#ifndef BAND_HI
+#define BAND_HI (MAX_TILES*N_POINT)
+#endif
+
+#ifndef INSTANCES
+#define INSTANCES 1
+#endif
+
+#ifdef FFT_CONV
+// DataInFFT<t> -> forward 8K -> filter -> inverse 8K -> DataOutFFT<t>
+fft_8k_conv_graph g;
+#elif defined(FFT_MULTI)
+// channel t of instance k: DataInFFT<8k+t> -> 1K FFT -> DataOutFFT<8k+t>
+fft_instances<fft_8k_multi_graph, INSTANCES> g;
+#else
+// copy k streams through DataInFFT<8k> ... DataInFFT<8k+7> and DataOutFFT<k*NUM_OUT> ...
+fft_instances<fft_8k_graph, INSTANCES> g;
+#endif
 
 #if defined(__AIESIM__) || defined(__X86SIM__)
 
+#ifdef FFT_CONV
+// The simulated filter passes the signal: H = 1 with the 1/N of the unscaled
+// inverse transform in the product shift, so DataOutFFT<t> reproduces
+// DataInFFT<t> (block floating point: samples * 2^exponent = N * input).
+static coeff_t<FFT_DTYPE> filter[MAX_TILES*CONV_BINS];
+static int filter_shift;
+
+static void pass_filter()
+{
+    using real=decltype(filter[0].real);
+    for (auto &c : filter) c={fft_traits<FFT_DTYPE>::FLOAT ? real(1.0/(MAX_TILES*N_POINT)) : real(1<<14),0};
+    filter_shift=BFP_TRAILER ? 14 : 14+13;
+}
+#endif
+
 int main(int argc,char** argv){
     g.init();
-    g.run(1);
+    g.update(g.window_type,WINDOW);
+    g.update(g.direction,DIRECTION);
+    g.update(g.out_shift,OUT_SHIFT);
+#if defined(FFT_MULTI)
+    // the 1K transforms take no band
+    g.update(g.band_lo,0);
+    g.update(g.band_hi,N_POINT);
+#elif !defined(FFT_CONV)
+    g.update(g.output_mode,OUTPUT_MODE);
+    g.update(g.average,AVERAGE);
+    g.update(g.band_lo,BAND_LO);
+    g.update(g.band_hi,BAND_HI);
+#else
+    // the whole spectrum takes part in the product
+    g.update(g.band_lo,0);
+    g.update(g.band_hi,MAX_TILES*N_POINT);
+    pass_filter();
+    for (unsigned h=0;h<CONV_SLICES;h++) g.update(g.filter[h],filter,MAX_TILES*CONV_BINS);
+    g.update(g.filter_shift,filter_shift);
+#endif
+    g.run(ITERATIONS);
     g.end();
     return 0;
 }
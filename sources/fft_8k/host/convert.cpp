@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Advanced Micro Devices, Inc
+//
+// SPDX-License-Identifier: MIT
+
+// Debug converter between the text sample files (notebook, simulator) and
+// the raw binary files host.exe maps: interleaved re/im of one scalar type.
+// Usage: convert.exe txt2bin|bin2txt <input> <output> [int16|int32|float|bfloat16]
+// bfloat16 is the power output of stage two, two bins to a line.
+// txt2bin skips the simulator's time stamps and TLAST marks.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// the upper half of a float, as stage two sends power
+struct bfloat16 {
+    uint16_t bits = 0;
+    bfloat16() = default;
+    explicit bfloat16(double v) {
+        float f = (float)v;
+        uint32_t u;
+        memcpy(&u, &f, 4);
+        bits = (u + 0x8000) >> 16;
+    }
+    operator float() const {
+        uint32_t u = (uint32_t)bits << 16;
+        float f;
+        memcpy(&f, &u, 4);
+        return f;
+    }
+};
+
+template<typename S>
+static int txt2bin(const char *in, const char *out) {
+    std::ifstream infile(in);
+    std::ofstream outfile(out, std::ios::binary);
+    if (!infile || !outfile) {
+        std::cerr << "cannot open " << (infile ? out : in) << std::endl;
+        return 1;
+    }
+    std::vector<S> v;
+    std::string tok;
+    while (infile >> tok) {
+        if (tok == "T") { infile >> tok >> tok; continue; }
+        if (tok == "TLAST") continue;
+        v.push_back((S)std::stod(tok));
+    }
+    if (v.size() % 2) {
+        std::cerr << in << ": odd number of values" << std::endl;
+        return 1;
+    }
+    outfile.write((const char *)v.data(), v.size() * sizeof(S));
+    std::cout << v.size() / 2 << " samples" << std::endl;
+    return 0;
+}
+
+template<typename S>
+static int bin2txt(const char *in, const char *out) {
+    FILE *infile = fopen(in, "rb");
+    std::ofstream outfile(out);
+    if (!infile || !outfile) {
+        std::cerr << "cannot open " << (infile ? out : in) << std::endl;
+        return 1;
+    }
+    S x[2];
+    size_t n = 0;
+    while (fread(x, sizeof(S), 2, infile) == 2) {
+        outfile << +x[0] << " " << +x[1] << "\n";
+        n++;
+    }
+    fclose(infile);
+    std::cout << n << " samples" << std::endl;
+    return 0;
+}
+
+template<typename S>
+static int convert(const std::string &mode, const char *in, const char *out) {
+    if (mode == "txt2bin") return txt2bin<S>(in, out);
+    if (mode == "bin2txt") return bin2txt<S>(in, out);
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    std::string type = argc >= 5 ? argv[4] : "int16";
+    int ret = -1;
+    if (argc >= 4) {
+        if (type == "int16") ret = convert<int16_t>(argv[1], argv[2], argv[3]);
+        else if (type == "int32") ret = convert<int32_t>(argv[1], argv[2], argv[3]);
+        else if (type == "float") ret = convert<float>(argv[1], argv[2], argv[3]);
+        else if (type == "bfloat16") ret = convert<bfloat16>(argv[1], argv[2], argv[3]);
+    }
+    if (ret < 0) {
+        std::cerr << "usage: convert.exe txt2bin|bin2txt <input> <output> [int16|int32|float|bfloat16]" << std::endl;
+        return 1;
+    }
+    return ret;
+}
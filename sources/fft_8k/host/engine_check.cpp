@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Advanced Micro Devices, Inc
+//
+// SPDX-License-Identifier: MIT
+
+// Device-free checks of FftEngine: which runs of registered frames XRT can
+// wrap as sub-buffers (FftEngine::runs_aligned). make check builds and runs it.
+
+#include "fft_engine.hpp"
+
+#include <iostream>
+
+typedef FftEngine<int16_t> engine;
+
+static int failed = 0;
+
+static void expect(bool got, bool want, const char *what) {
+    if (got != want) {
+        std::cerr << "FAIL " << what << ": " << got << ", expected " << want << std::endl;
+        failed++;
+    }
+}
+
+int main() {
+    // an 8K cint16 frame, 32 KiB: every run of every range is aligned
+    expect(engine::runs_aligned(32768, 0, 16, 4), true, "8K frames from 0");
+    expect(engine::runs_aligned(32768, 5, 9, 3), true, "8K frames from 5");
+    // a 256-sample cint16 hop, 1 KiB: runs start aligned every 4 frames only
+    expect(engine::runs_aligned(1024, 0, 16, 4), true, "1 KiB hops, runs of 4");
+    expect(engine::runs_aligned(1024, 0, 12, 3), false, "1 KiB hops, runs of 3");
+    expect(engine::runs_aligned(1024, 4, 8, 4), true, "1 KiB hops from 4");
+    expect(engine::runs_aligned(1024, 2, 8, 4), false, "1 KiB hops from 2");
+    // a frame that is no divisor of 4 KiB either
+    expect(engine::runs_aligned(6144, 0, 4, 2), true, "6 KiB frames from 0");
+    expect(engine::runs_aligned(6144, 1, 4, 2), false, "6 KiB frames from 1");
+    expect(engine::runs_aligned(6144, 0, 4, 1), false, "6 KiB frames, runs of 1");
+    // a single run starts at its first frame
+    expect(engine::runs_aligned(1024, 8, 3, 4), true, "one run of 1 KiB hops");
+    std::cout << (failed ? "FAILED" : "PASSED") << std::endl;
+    return failed != 0;
+}
@@ -0,0 +1,850 @@
+// Copyright (C) 2023 Advanced Micro Devices, Inc
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// FftEngine: the device opened and the xclbin loaded once, a pool of
+// pre-allocated buffer pairs per graph instance, and frames submitted from
+// any thread. Frames are packed into batches of up to frames_per_run; a batch
+// is launched when it is full or flush_us after its first frame. A launcher
+// thread syncs the batch and starts the mm2s/s2mm runs while a completion
+// thread waits for earlier batches and fulfils their futures, so transfers,
+// graph execution and result delivery overlap.
+//
+// Neither direction needs a copy: frames in memory registered with
+// register_frames() are wrapped as a user-pointer buffer object and mm2s
+// reads them where they are, and a result is a view of the pool buffer s2mm
+// wrote it to. The buffer returns to the pool when the last result of its
+// batch is destroyed; the pool grows while results are held.
+//
+// A result is one output frame as the s2mm kernels wrote it: the streams of
+// stage two in order, each followed by its block-floating-point trailer,
+// or (natural_output) all bins in natural frequency order, then the trailer,
+// or (real_pairs) the half spectra of two real signals, see submit_pair().
+//
+// With hop the engine computes a spectrogram: every submission is the next
+// hop samples of one continuous signal and its result is the spectrum of
+// the last npoints * NSAMPLES samples. mm2s keeps that history on chip, so
+// overlapping frames cross the bus only once.
+//
+// A convolution xclbin (conv) filters instead: a result is the input frame
+// circularly convolved with the filter of set_filter(), in the tile-major
+// layout of the input; with hop it is overlap-save filtering of the signal.
+//
+// A multichannel xclbin (multi) runs eight independent 1K transforms instead:
+// a frame is eight channels of NSAMPLES samples, one after the other, and its
+// result their eight spectra, each with its trailer.
+//
+// inverse turns the transform into N * IDFT and out_shift scales its results;
+// set_transform() switches both between frames, without loading the xclbin
+// again.
+//
+// The 8K stage two can send the power (bfloat16) or the dB value (int16,
+// 1/128 dB) of every bin in place of the complex bins (output_mode), 2 bytes
+// a bin, and with a Welch build the mean power of
+// average frames: only the last frame of such a group gets a result, the
+// others an empty one. set_spectrum() switches between frames.
+//
+// It can also compute a band of bins alone (band_lo, band_hi): stage one
+// skips the last butterflies no bin of the band needs, stage two computes
+// and streams the band only, and a result holds its bins in natural order,
+// then the trailers. set_band() switches between frames.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <stdexcept>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "xrt.h"
+#include "experimental/xrt_kernel.h"
+#include "experimental/xrt_graph.h"
+
+#define NSAMPLES 1024
+#ifdef FFT_BFP
+#define TRAILER_BEATS 2 // 8 cint16 after every frame, the first one is {exponent, peak}
+#else
+#define TRAILER_BEATS 0
+#endif
+
+enum class fft_dispatch {
+    rr,    // batch k to instance k % instances
+    depth, // to the instance with the fewest runs still executing
+};
+
+struct fft_engine_config {
+    std::string xclbin = "./fft.xclbin";
+    unsigned device = 0;
+    int npoints = 8;        // frames of npoints * NSAMPLES samples
+    int instances = 1;      // graph instances in the xclbin (make INSTANCES=<n>)
+    int frames_per_run = 1; // frames moved by a single mm2s/s2mm run
+    int slots = 2;          // buffer pairs per instance, 2 is double buffering
+    fft_dispatch dispatch = fft_dispatch::rr;
+    int flush_us = 100;     // longest wait for a batch to fill up
+    // Input frames in natural sample order; mm2s does the stride-8 gather.
+    // Otherwise tile t of a frame is the subsequence x[8m+t], tile after tile.
+    bool natural_order = false;
+    // Results in natural frequency order; s2mm does the digit reversal.
+    // Otherwise in the order stage two streams them.
+    bool natural_output = false;
+    // Two-for-one real transform: s2mm splits the spectrum of a + jb into
+    // the half spectra of the real signals a and b (make REAL=1 builds).
+    bool real_pairs = false;
+    // Window the AIE applies to every input frame: 0 none, 1 Hann,
+    // 2 Blackman (WINDOW_* of the kernels), see set_window(); none for conv
+    int window = 0;
+    // Inverse transform, N * IDFT (direction RTP), and the right shift of the
+    // results (out_shift RTP, 13 for the 1/N of 8K; with FFT_BFP the
+    // exponent takes it), see set_transform()
+    bool inverse = false;
+    int out_shift = 0;
+    // STFT hop in samples, 0 off: a multiple of 64 / sizeof(S) (one mm2s
+    // block) up to a whole frame. Needs a single instance; the signal is read
+    // in natural order whatever natural_order says, and the spectra before
+    // the first npoints * NSAMPLES samples see zeros in place of the past.
+    int hop = 0;
+    // Overlap-save convolution xclbin (make CONV=1, out_streams 8): result
+    // t*(NSAMPLES+trailer)+m is y[8m+t], every inverse tile with its own BFP
+    // trailer. Load the filter with set_filter() before the first frame.
+    bool conv = false;
+    // Multichannel xclbin (make MULTI=1, out_streams 8): channel t of a frame
+    // at t*NSAMPLES (tile order), its spectrum at t*(NSAMPLES+trailer) of the
+    // result in natural order; window, inverse and out_shift as for a 1K FFT
+    bool multi = false;
+    // 8K only: 0 complex bins, 1 |X|^2 as bfloat16, 2 10*log10(|X|^2) as
+    // int16 in 1/128 dB, in the bin order output_mode 0 would have (8 bins
+    // per 16 bytes). Results carry the raw bytes; see set_spectrum()
+    int output_mode = 0;
+    // frames whose mean power makes up one result, > 1 needs welch and
+    // output_mode 1 or 2
+    int average = 1;
+    bool welch = false;     // the graph keeps power sums (make WELCH=1, out_streams 8)
+    // 8K only: the bins band_lo ... band_hi - 1 (multiples of 4) alone, in
+    // natural order whatever natural_output says; complex output only.
+    // band_hi 0 is N, 0 and N the whole spectrum. See set_band()
+    int band_lo = 0;
+    int band_hi = 0;
+    int out_streams = 1;    // stage-two output streams of the build (make OUT_STREAMS=<n>)
+};
+
+// S: scalar of the sample type, int16_t/int32_t/float for cint16/cint32/cfloat
+template<typename S>
+class FftEngine {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    // The wider types run stage two as at least S2_SPLIT kernels
+    static constexpr int S2_SPLIT = sizeof(S) / sizeof(int16_t);
+    // filter spectrum scalar: Q-format int16 for the integer types
+    using coeff = typename std::conditional<std::is_same<S, float>::value, float, int16_t>::type;
+    // filter RTPs of a convolution graph, one per slice of the bins (CONV_SLICES of the kernels)
+    static constexpr int CONV_SLICES = 4;
+
+    struct statistics {
+        std::vector<long> frames;          // delivered per instance
+        std::vector<double> run_latency_us;   // first frame submitted to batch delivered
+        std::vector<double> frame_latency_us; // every frame, submitted to delivered
+        int out_buffers = 0;               // s2mm buffers allocated, pool and lent out
+    };
+
+    // A result: the frame in the pool buffer s2mm wrote it to, or empty (a
+    // frame still being averaged). Holding it holds the buffer of its batch;
+    // copy the values out to keep them longer.
+    class result {
+    public:
+        result() = default;
+        const S *data() const { return p.get(); }
+        size_t size() const { return n; }
+        bool empty() const { return n == 0; }
+        const S &operator[](size_t k) const { return p.get()[k]; }
+        const S *begin() const { return p.get(); }
+        const S *end() const { return p.get() + n; }
+
+    private:
+        friend class FftEngine;
+        result(std::shared_ptr<const S> p, size_t n) : p(std::move(p)), n(n) {}
+        std::shared_ptr<const S> p;
+        size_t n = 0;
+    };
+
+    // Whole input frames in caller memory, wrapped as a user-pointer buffer
+    // object by register_frames(); valid while the memory is.
+    class frame_buffer {
+    public:
+        size_t frames() const { return n; }
+
+    private:
+        friend class FftEngine;
+        xrt::bo bo;
+        size_t n = 0;
+    };
+
+    explicit FftEngine(const fft_engine_config &cfg) : cfg(cfg) {
+        frame_size = sizeof(S) * 2 * cfg.npoints * NSAMPLES;
+        frame_beats = frame_size / 16;
+        // every output stream of stage two drains into its own s2mm
+        outputs = std::max(S2_SPLIT, cfg.out_streams);
+        // what one s2mm receives of a complex frame: its share of the bins
+        // and the trailer (cint16 only); input frames carry no trailer. The
+        // pool is sized for it, power and dB frames are smaller.
+        out_frame_size = stream_beats(0) * 16;
+        if (cfg.real_pairs && outputs != 1) {
+            throw std::invalid_argument("real_pairs needs the whole spectrum in one s2mm (REAL=1: cint16, out_streams 1)");
+        }
+        // a submission carries the hop new samples; one history, one instance
+        if (cfg.hop < 0 || cfg.hop > cfg.npoints * NSAMPLES || cfg.hop % (64 / sizeof(S)) != 0 ||
+            (cfg.hop && (cfg.instances != 1 || cfg.real_pairs))) {
+            throw std::invalid_argument("hop must be a multiple of 64 / sizeof(S) up to a frame, "
+                                        "with one instance and without real_pairs");
+        }
+        in_frame_size = cfg.hop ? sizeof(S) * 2 * cfg.hop : frame_size;
+        if (cfg.conv && (cfg.npoints != 8 || outputs != 8 || cfg.natural_output || cfg.real_pairs)) {
+            throw std::invalid_argument("conv needs the 8K graph with out_streams 8 and results in stream order");
+        }
+        // the channels are the tiles: mm2s must not gather, s2mm not reorder
+        if (cfg.multi && (cfg.npoints != 8 || outputs != 8 || cfg.natural_order || cfg.natural_output ||
+                          cfg.real_pairs || cfg.hop || cfg.conv)) {
+            throw std::invalid_argument("multi needs out_streams 8 and frames and results in tile and stream "
+                                        "order, without real_pairs, hop or conv");
+        }
+
+        device = xrt::device(cfg.device);
+        auto uuid = device.load_xclbin(cfg.xclbin);
+
+        // instance i is fed by mm2s_fft_i and drains into
+        // s2mm_fft_<i*outputs> ... s2mm_fft_<i*outputs+outputs-1>
+        dm_out.resize(cfg.instances);
+        for (int i = 0; i < cfg.instances; i++) {
+            dm_in.emplace_back(device, uuid, "mm2s:{mm2s_fft_" + std::to_string(i) + "}");
+            for (int h = 0; h < outputs; h++) {
+                dm_out[i].emplace_back(device, uuid, "s2mm:{s2mm_fft_" + std::to_string(i * outputs + h) + "}");
+            }
+        }
+
+        // The graphs are not controlled from the host: they start with the
+        // xclbin and keep consuming frames for as long as mm2s feeds them, so
+        // a slot only needs its buffers and data mover runs. Only the RTPs,
+        // shared by every instance, have to be written before the first
+        // frame.
+        graph = xrt::graph(device, uuid, "g");
+        write_window(cfg.window);
+        write_transform(cfg.inverse, cfg.out_shift);
+        write_spectrum(cfg.output_mode, cfg.average);
+        write_band(cfg.band_lo, cfg.band_hi ? cfg.band_hi : cfg.npoints * NSAMPLES);
+        // The eight mm2s ports and the s2mm ports share the default memory
+        // bank (no sp= in hw_link), so one buffer serves every port.
+        outs = std::make_shared<out_pool>();
+        outs->spare.resize(cfg.instances);
+        pool.resize(cfg.instances * cfg.slots);
+        for (int k = 0; k < (int)pool.size(); k++) {
+            slot &sl = pool[k];
+            sl.inst = k / cfg.slots;
+            sl.in = xrt::bo(device, cfg.frames_per_run * in_frame_size, dm_in[sl.inst].group_id(0));
+            sl.in_map = sl.in.template map<S *>();
+            sl.out = new_out(sl.inst);
+            sl.run_out.resize(outputs);
+        }
+        stats.frames.assign(cfg.instances, 0);
+
+        launcher = std::thread(&FftEngine::launch_loop, this);
+        completer = std::thread(&FftEngine::complete_loop, this);
+    }
+
+    // delivers everything already submitted
+    ~FftEngine() {
+        {
+            std::lock_guard<std::mutex> lk(m);
+            stopping = true;
+        }
+        cv_launch.notify_one();
+        launcher.join();
+        completer.join();
+    }
+
+    FftEngine(const FftEngine &) = delete;
+    FftEngine &operator=(const FftEngine &) = delete;
+
+    // S values of an input frame (the hop new samples with hop), re/im interleaved
+    size_t frame_values() const { return in_frame_size / sizeof(S); }
+    // S values of a result in the current output_mode and band (empty ones aside)
+    size_t result_values() const {
+        std::lock_guard<std::mutex> lk(m);
+        return frame_result_values(output_mode, band_lo, band_hi);
+    }
+
+    // S value index of the first BFP trailer (stream 0's) in a complex
+    // result: after the band, after all bins in natural order, or otherwise
+    // after the slice of stream 0, as s2mm stores the streams one by one
+    size_t trailer_index() const {
+        std::lock_guard<std::mutex> lk(m);
+        if (band_hi) return (band_hi - band_lo) * 2;
+        bool natural = cfg.natural_output || cfg.real_pairs;
+        return (natural ? frame_beats : frame_beats / outputs) * 16 / sizeof(S);
+    }
+
+    // XRT places a user-pointer buffer and every sub-buffer of one (a run of
+    // registered frames) at a multiple of this many bytes
+    static constexpr size_t BO_ALIGN = 4096;
+
+    // Whether submit(buffer, first, n) can read frames first ... first + n - 1
+    // of frame_bytes each in place when runs take per_run frames: every run
+    // has to start at a multiple of BO_ALIGN. Frames of a multiple of 4 KiB
+    // always can; smaller frames and STFT hops only from some frames on.
+    static bool runs_aligned(size_t frame_bytes, size_t first, size_t n, size_t per_run) {
+        for (size_t k = 0; k < n; k += per_run) {
+            if ((first + k) * frame_bytes % BO_ALIGN != 0) return false;
+        }
+        return true;
+    }
+
+    // Wraps n frames of frame_values() values at frames for submit(buffer,
+    // first, n). XRT pins the pages of a user-pointer BO, so the memory must
+    // be page aligned and writable (a read-only file mapping is not; map it
+    // MAP_PRIVATE with PROT_WRITE). The engine reads the frames in place:
+    // leave them unchanged until their results are delivered.
+    frame_buffer register_frames(const S *frames, size_t n) {
+        if ((uintptr_t)frames % BO_ALIGN != 0 || n == 0) {
+            throw std::invalid_argument("registered frames must be page aligned and not empty");
+        }
+        frame_buffer b;
+        b.bo = xrt::bo(device, (void *)frames, n * in_frame_size, dm_in[0].group_id(0));
+        b.n = n;
+        return b;
+    }
+
+    // Frames first ... first + n - 1 of a registered buffer, without a copy:
+    // every run of up to frames_per_run of them reads a window of the buffer,
+    // which has to be aligned (runs_aligned(); submit copies otherwise).
+    // They are launched at once, after any frames submitted before.
+    std::vector<std::future<result>> submit(const frame_buffer &buffer, size_t first, size_t n) {
+        if (first + n > buffer.n) {
+            throw std::invalid_argument("frames past the end of the registered buffer");
+        }
+        if (!runs_aligned(in_frame_size, first, n, cfg.frames_per_run)) {
+            throw std::invalid_argument("runs of registered frames must start at a multiple of 4 KiB");
+        }
+        std::vector<std::future<result>> f;
+        std::unique_lock<std::mutex> lk(m);
+        // the pool frames before them go first
+        if (filling) {
+            ready.push_back(filling);
+            filling = nullptr;
+            cv_launch.notify_one();
+        }
+        for (size_t k = 0; k < n; k += cfg.frames_per_run) {
+            size_t c = std::min(n - k, (size_t)cfg.frames_per_run);
+            slot *sl;
+            while (!(sl = pick())) cv_space.wait(lk);
+            sl->first = clock_type::now();
+            sl->src = xrt::bo(buffer.bo, c * in_frame_size, (first + k) * in_frame_size);
+            for (size_t j = 0; j < c; j++) {
+                sl->promises.emplace_back();
+                sl->submitted.push_back(sl->first);
+                f.push_back(sl->promises.back().get_future());
+            }
+            ready.push_back(sl);
+            cv_launch.notify_one();
+        }
+        return f;
+    }
+
+    // Copies frame_values() values into a pool buffer and returns at once,
+    // unless every buffer of the pool is taken. Frames already in memory
+    // are better registered.
+    std::future<result> submit(const S *frame) {
+        std::unique_lock<std::mutex> lk(m);
+        return enqueue(lk, [&](S *in) { memcpy(in, frame, in_frame_size); });
+    }
+
+    // real_pairs: two real signals of npoints * NSAMPLES values each, packed
+    // as a + jb in the configured input order. The result holds A[k] for
+    // k < N/2, then B[k]; A[0] and B[0] carry bin N/2 as imaginary part.
+    std::future<result> submit_pair(const S *a, const S *b) {
+        int n = cfg.npoints * NSAMPLES;
+        std::unique_lock<std::mutex> lk(m);
+        return enqueue(lk, [&](S *in) {
+            for (int k = 0; k < n; k++) {
+                // tile order: x[8m+t] at t * NSAMPLES + m
+                int p = cfg.natural_order ? k : (k % cfg.npoints) * NSAMPLES + k / cfg.npoints;
+                in[2 * p] = a[k];
+                in[2 * p + 1] = b[k];
+            }
+        });
+    }
+
+    // n consecutive frames, packed into as few runs as possible (copied)
+    std::vector<std::future<result>> submit(const S *frames, size_t n) {
+        std::vector<std::future<result>> f;
+        std::unique_lock<std::mutex> lk(m);
+        for (size_t k = 0; k < n; k++) {
+            const S *frame = frames + k * frame_values();
+            f.push_back(enqueue(lk, [&](S *in) { memcpy(in, frame, in_frame_size); }));
+        }
+        return f;
+    }
+
+    // Selects the window of the frames submitted from now on. Like
+    // set_transform() it drains first.
+    void set_window(int window) {
+        drain();
+        write_window(window);
+    }
+
+    // Switches between FFT and IFFT, and the output shift, without loading
+    // the xclbin again. Stage one and stage two read the RTPs on their own,
+    // so a frame in flight could see both settings: the engine drains first
+    // and the frames submitted afterwards see the new one. Call it from the
+    // submitting thread.
+    void set_transform(bool inverse, int out_shift) {
+        drain();
+        write_transform(inverse, out_shift);
+    }
+
+    // Selects the output_mode and the frames averaged per result. Like
+    // set_transform() it drains first. The groups of average frames start
+    // over when either setting changes; a group left open at the drain is
+    // completed by the frames submitted next.
+    void set_spectrum(int output_mode, int average) {
+        drain();
+        write_spectrum(output_mode, average);
+    }
+
+    // Narrows the transform to the bins band_lo ... band_hi - 1, 0 and N for
+    // the whole spectrum. Like set_transform() it drains first.
+    void set_band(int band_lo, int band_hi) {
+        drain();
+        write_band(band_lo, band_hi);
+    }
+
+    // conv: the filter spectrum H, npoints * NSAMPLES bins in natural order
+    // with re/im interleaved; a result is N * IDFT(DFT(x) * H / 2^shift).
+    // With FFT_BFP the shift of the 1/N stays in the exponents. Frames in
+    // flight may still see the previous filter.
+    void set_filter(const coeff *H, int shift) {
+        const int n = cfg.npoints * NSAMPLES, bins = NSAMPLES / CONV_SLICES;
+        for (int h = 0; h < CONV_SLICES; h++) {
+            // slice h: bin NSAMPLES*q + h*bins + j at q*bins + j
+            std::array<coeff, 2 * 8 * NSAMPLES / CONV_SLICES> slice;
+            for (int k = 0; k < n; k++) {
+                int q = k / NSAMPLES, r = k % NSAMPLES;
+                if (r / bins != h) continue;
+                slice[2 * (q * bins + r % bins)] = H[2 * k];
+                slice[2 * (q * bins + r % bins) + 1] = H[2 * k + 1];
+            }
+            graph.update("g.filter[" + std::to_string(h) + "]", slice);
+        }
+        graph.update("g.filter_shift", shift);
+    }
+
+    // launch a partly filled batch without waiting for flush_us
+    void flush() {
+        {
+            std::lock_guard<std::mutex> lk(m);
+            flush_now = true;
+        }
+        cv_launch.notify_one();
+    }
+
+    // flush and wait until every submitted frame has been delivered
+    void drain() {
+        flush();
+        std::unique_lock<std::mutex> lk(m);
+        cv_idle.wait(lk, [&] { return !filling && ready.empty() && running.empty(); });
+    }
+
+    statistics get_statistics() const {
+        std::lock_guard<std::mutex> lk(m);
+        statistics st = stats;
+        std::lock_guard<std::mutex> lk_outs(outs->m);
+        st.out_buffers = outs->allocated;
+        return st;
+    }
+
+private:
+    // what one run of s2mm writes: frames_per_run frames of every stream
+    struct out_buffer {
+        xrt::bo bo;
+        S *map;
+    };
+
+    // s2mm buffers back from the results that held them, per instance; shared
+    // with the results, which may still release theirs after the engine
+    struct out_pool {
+        std::mutex m;
+        std::vector<std::vector<std::unique_ptr<out_buffer>>> spare;
+        int allocated = 0;
+    };
+
+    struct slot {
+        int inst;
+        bool busy = false;
+        xrt::bo in;
+        S *in_map;
+        xrt::bo src;                      // what mm2s reads: in, or a registered window
+        std::unique_ptr<out_buffer> out;  // nullptr while lent to results
+        xrt::run run_in;
+        std::vector<xrt::run> run_out;
+        std::vector<std::promise<result>> promises; // one per frame of the batch
+        std::vector<clock_type::time_point> submitted; // and when it came
+        std::vector<char> emits;    // the frame ends a group of average frames
+        int mode;                   // output_mode of the batch
+        int lo, hi;                 // its band, 0 and 0 for the whole spectrum
+        clock_type::time_point first;
+        std::exception_ptr error;
+    };
+
+    const fft_engine_config cfg;
+    size_t frame_size, in_frame_size, out_frame_size;
+    int frame_beats;
+    int outputs; // s2mm per instance
+
+    xrt::device device;
+    xrt::graph graph;
+    std::vector<xrt::kernel> dm_in;
+    std::vector<std::vector<xrt::kernel>> dm_out;
+    std::vector<slot> pool;
+    std::shared_ptr<out_pool> outs;
+
+    // every s2mm of instance i writes its stream into the same frames
+    std::unique_ptr<out_buffer> new_out(int i) {
+        std::unique_ptr<out_buffer> b(new out_buffer);
+        b->bo = xrt::bo(device, cfg.frames_per_run * outputs * out_frame_size, dm_out[i][0].group_id(0));
+        b->map = b->bo.template map<S *>();
+        std::lock_guard<std::mutex> lk(outs->m);
+        outs->allocated++;
+        return b;
+    }
+
+    // a spare buffer of instance i, or a new one while results hold them all
+    std::unique_ptr<out_buffer> take_out(int i) {
+        {
+            std::lock_guard<std::mutex> lk(outs->m);
+            auto &spare = outs->spare[i];
+            if (!spare.empty()) {
+                auto b = std::move(spare.back());
+                spare.pop_back();
+                return b;
+            }
+        }
+        return new_out(i);
+    }
+
+    // beats one s2mm receives of a frame in output mode mode: 2 bytes per bin
+    // of power (bfloat16) or dB
+    int stream_beats(int mode) const {
+        int bins = cfg.npoints * NSAMPLES;
+        int beats = mode ? bins * 2 / 16 : frame_beats;
+        return beats / outputs + TRAILER_BEATS;
+    }
+
+    // beats s2mm h receives of a frame of the band lo ... hi - 1: the groups
+    // of 4 bins of its rows inside the band (stage two slice h % kernels of
+    // rows (h / kernels) * rows ...), and the trailer
+    int band_beats(int h, int lo, int hi) const {
+        const int groups = NSAMPLES / 4, group_beats = 4 * 2 * sizeof(S) / 16;
+        int kernels = std::max(S2_SPLIT, cfg.out_streams / 2), rows = 8 * kernels / outputs;
+        int beats = TRAILER_BEATS;
+        for (int q = h / kernels * rows; q < (h / kernels + 1) * rows; q++) {
+            int a = std::max(h % kernels * groups / kernels, lo / 4 - q * groups);
+            int b = std::min((h % kernels + 1) * groups / kernels, hi / 4 - q * groups);
+            beats += std::max(b - a, 0) * group_beats;
+        }
+        return beats;
+    }
+
+    // S values of a result: every stream of the frame, or the bins of the
+    // band and the trailers of all streams
+    size_t frame_result_values(int mode, int lo, int hi) const {
+        if (hi) return ((hi - lo) * 2 * sizeof(S) + outputs * TRAILER_BEATS * 16) / sizeof(S);
+        return outputs * stream_beats(mode) * 16 / sizeof(S);
+    }
+
+    void write_spectrum(int mode, int avg) {
+        if (mode < 0 || mode > 2 || avg < 1) {
+            throw std::invalid_argument("output_mode must be 0, 1 or 2 and average positive");
+        }
+        // the s2mm split and the convolution graph expect complex bins
+        if (mode && (cfg.npoints != 8 || cfg.real_pairs || cfg.conv || cfg.multi)) {
+            throw std::invalid_argument("power and dB output need the 8K graph, without real_pairs, conv or multi");
+        }
+        if (mode && band_hi) {
+            throw std::invalid_argument("a band is sent as complex bins, output_mode 0");
+        }
+        if (avg > 1 && (!cfg.welch || cfg.out_streams != 8 || !mode)) {
+            throw std::invalid_argument("average > 1 needs a welch build (out_streams 8) and power or dB output");
+        }
+        // the 1K/4K, convolution and multichannel graphs have no such RTPs
+        if (cfg.npoints == 8 && !cfg.conv && !cfg.multi) {
+            graph.update("g.output_mode", mode);
+            graph.update("g.average", avg);
+        }
+        std::lock_guard<std::mutex> lk(m);
+        // stage two restarts its groups only when a setting changes
+        if (mode != output_mode || avg != average) groups.assign(cfg.instances, 0);
+        output_mode = mode;
+        average = avg;
+    }
+
+    void write_band(int lo, int hi) {
+        const int n = cfg.npoints * NSAMPLES;
+        if (lo < 0 || hi > n || lo >= hi || lo % 4 || hi % 4) {
+            throw std::invalid_argument("the band must be multiples of 4 with 0 <= band_lo < band_hi <= N");
+        }
+        bool whole = lo == 0 && hi == n;
+        // the s2mm split and the convolution graph work on the whole spectrum
+        if (!whole && (cfg.npoints != 8 || cfg.real_pairs || cfg.conv || cfg.multi || output_mode)) {
+            throw std::invalid_argument("a band needs the 8K graph and complex output, without real_pairs, conv or multi");
+        }
+        // every graph has the ports, the 1K/4K, convolution and multichannel graphs keep 0 and N
+        graph.update("g.band_lo", lo);
+        graph.update("g.band_hi", hi);
+        std::lock_guard<std::mutex> lk(m);
+        band_lo = whole ? 0 : lo;
+        band_hi = whole ? 0 : hi;
+    }
+
+    void write_window(int window) {
+        if (window < 0 || window > 2) {
+            throw std::invalid_argument("window must be 0, 1 or 2");
+        }
+        // the filter would act on the windowed frame, not a convolution any more
+        if (window && cfg.conv) {
+            throw std::invalid_argument("conv runs without a window");
+        }
+        graph.update("g.window_type", window);
+    }
+
+    void write_transform(bool inverse, int out_shift) {
+        // the s2mm split and the convolution graph expect the forward transform
+        if ((inverse || out_shift) && (cfg.real_pairs || cfg.conv)) {
+            throw std::invalid_argument("real_pairs and conv run the forward transform only");
+        }
+        if (out_shift < 0 || out_shift > 31) {
+            throw std::invalid_argument("out_shift must be 0 ... 31");
+        }
+        graph.update("g.direction", inverse ? 1 : 0);
+        graph.update("g.out_shift", out_shift);
+    }
+
+    // all below under m
+    mutable std::mutex m;
+    std::condition_variable cv_space, cv_launch, cv_done, cv_idle;
+    slot *filling = nullptr;        // batch taking frames
+    std::deque<slot *> ready;       // batches waiting for the launcher
+    std::deque<slot *> running;     // launched, in launch order
+    int next_inst = 0;
+    bool flush_now = false, stopping = false, launcher_done = false;
+    bool signal_started = false; // hop: the first run clears the history
+    int output_mode = -1, average = 0; // as stage two last saw them
+    int band_lo = 0, band_hi = 0;      // 0 and 0: the whole spectrum
+    std::vector<int> groups;    // per instance, frames of the open group
+    statistics stats;
+
+    std::thread launcher, completer;
+
+    // fill writes the frame into its place in the pool buffer
+    template<typename F>
+    std::future<result> enqueue(std::unique_lock<std::mutex> &lk, F fill) {
+        while (!filling && !(filling = pick())) cv_space.wait(lk);
+        slot &sl = *filling;
+        size_t pos = sl.promises.size();
+        auto now = clock_type::now();
+        if (pos == 0) {
+            sl.first = now;
+            sl.src = sl.in;
+        }
+        fill(sl.in_map + pos * frame_values());
+        sl.promises.emplace_back();
+        sl.submitted.push_back(now);
+        auto f = sl.promises.back().get_future();
+        if ((int)sl.promises.size() == cfg.frames_per_run) {
+            ready.push_back(filling);
+            filling = nullptr;
+            cv_launch.notify_one();
+        } else if (pos == 0) {
+            cv_launch.notify_one(); // starts the flush timer
+        }
+        return f;
+    }
+
+    // runs of instance i whose output has not fully landed yet
+    int executing(int i) const {
+        int n = 0;
+        for (auto *sl : running) {
+            if (sl->inst == i && sl->run_out.back().state() != ERT_CMD_STATE_COMPLETED) n++;
+        }
+        return n;
+    }
+
+    // a free slot of the instance the dispatch policy picks, or nullptr
+    slot *pick() {
+        int best = -1, depth = 0;
+        for (int c = 0; c < cfg.instances; c++) {
+            int i = (next_inst + c) % cfg.instances;
+            bool free_slot = false;
+            for (int s = 0; s < cfg.slots; s++) free_slot |= !pool[i * cfg.slots + s].busy;
+            if (free_slot && (best < 0 || executing(i) < depth)) {
+                best = i;
+                depth = executing(i);
+            }
+            // round robin waits for its instance
+            if (cfg.dispatch == fft_dispatch::rr) break;
+        }
+        if (best < 0) return nullptr;
+        next_inst = (best + 1) % cfg.instances;
+        for (int s = 0; s < cfg.slots; s++) {
+            slot &sl = pool[best * cfg.slots + s];
+            if (!sl.busy) {
+                sl.busy = true;
+                return &sl;
+            }
+        }
+        return nullptr;
+    }
+
+    void launch_loop() {
+        std::unique_lock<std::mutex> lk(m);
+        for (;;) {
+            if (ready.empty()) {
+                if (filling) {
+                    auto deadline = filling->first + std::chrono::microseconds(cfg.flush_us);
+                    if (flush_now || stopping || clock_type::now() >= deadline) {
+                        ready.push_back(filling);
+                        filling = nullptr;
+                        flush_now = false;
+                    } else {
+                        cv_launch.wait_until(lk, deadline);
+                    }
+                    continue;
+                }
+                flush_now = false;
+                if (stopping) break;
+                cv_launch.wait(lk);
+                continue;
+            }
+            slot *sl = ready.front();
+            ready.pop_front();
+            int n = sl->promises.size(), i = sl->inst;
+            int start = !signal_started;
+            signal_started = true;
+            // stage two of the instance sees the frames in launch order; only
+            // those closing a group reach s2mm
+            int mode = sl->mode = output_mode, emitted = 0;
+            int lo = sl->lo = band_lo, hi = sl->hi = band_hi;
+            sl->emits.resize(n);
+            for (int f = 0; f < n; f++) {
+                sl->emits[f] = ++groups[i] == average;
+                if (sl->emits[f]) groups[i] = 0;
+                emitted += sl->emits[f];
+            }
+            lk.unlock();
+
+            // Synchronize input buffers data to device global memory and
+            // execute the compute units
+            try {
+                if (!sl->out) sl->out = take_out(i);
+                xrt::bo &src = sl->src;
+                src.sync(XCL_BO_SYNC_BO_TO_DEVICE, n * in_frame_size, 0);
+                // one read port per stage-one tile and the natural-order
+                // port, all on the same buffer; runs of the one instance
+                // execute in launch order, so with hop the signal stays whole
+                sl->run_in = dm_in[i](src, src, src, src, src, src, src, src, src,
+                                      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                      n * frame_beats, (int)cfg.natural_order, cfg.hop, start);
+                for (int h = 0; h < outputs; h++) {
+                    int beats = hi ? band_beats(h, lo, hi) : stream_beats(mode);
+                    sl->run_out[h] = dm_out[i][h](sl->out->bo, nullptr, emitted * beats, h,
+                                               cfg.real_pairs ? 2 : (int)cfg.natural_output, mode,
+                                               lo, hi ? hi : 8 * NSAMPLES);
+                }
+            } catch (...) {
+                sl->error = std::current_exception();
+            }
+
+            lk.lock();
+            running.push_back(sl);
+            cv_done.notify_one();
+        }
+        launcher_done = true;
+        cv_done.notify_one();
+    }
+
+    void complete_loop() {
+        std::unique_lock<std::mutex> lk(m);
+        for (;;) {
+            cv_done.wait(lk, [&] { return !running.empty() || launcher_done; });
+            if (running.empty()) break;
+            // stays in running until delivered, executing() counts it
+            slot *sl = running.front();
+            lk.unlock();
+
+            // Wait for kernels to complete, synchronize the output buffer
+            // data from the device and hand out the frames
+            int n = sl->promises.size();
+            size_t values = frame_result_values(sl->mode, sl->lo, sl->hi);
+            int emitted = std::count(sl->emits.begin(), sl->emits.end(), 1);
+            if (!sl->error) {
+                try {
+                    for (auto &r : sl->run_out) r.wait();
+                    sl->run_in.wait();
+                    if (emitted) sl->out->bo.sync(XCL_BO_SYNC_BO_FROM_DEVICE, emitted * values * sizeof(S), 0);
+                } catch (...) {
+                    sl->error = std::current_exception();
+                }
+            }
+            auto done = clock_type::now();
+            {
+                // counted before the futures become ready
+                std::lock_guard<std::mutex> lk_stats(m);
+                if (!sl->error) stats.frames[sl->inst] += n;
+                stats.run_latency_us.push_back(std::chrono::duration<double, std::micro>(done - sl->first).count());
+                for (auto t : sl->submitted)
+                    stats.frame_latency_us.push_back(std::chrono::duration<double, std::micro>(done - t).count());
+            }
+            // the results share the buffer, the last one hands it back
+            std::shared_ptr<out_buffer> held;
+            if (!sl->error && emitted) {
+                auto o = outs;
+                int i = sl->inst;
+                held.reset(sl->out.release(), [o, i](out_buffer *b) {
+                    std::lock_guard<std::mutex> lk_outs(o->m);
+                    o->spare[i].emplace_back(b);
+                });
+            }
+            for (int f = 0, k = 0; f < n; f++) {
+                if (sl->error) {
+                    sl->promises[f].set_exception(sl->error);
+                    continue;
+                }
+                if (!sl->emits[f]) {
+                    sl->promises[f].set_value(result());
+                    continue;
+                }
+                std::shared_ptr<const S> y(held, held->map + k++ * values);
+                sl->promises[f].set_value(result(std::move(y), values));
+            }
+            held.reset();
+
+            lk.lock();
+            sl->promises.clear();
+            sl->submitted.clear();
+            sl->error = nullptr;
+            sl->busy = false;
+            running.pop_front();
+            cv_space.notify_all();
+            cv_idle.notify_all();
+        }
+    }
+};
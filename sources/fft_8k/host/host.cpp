@@ -4,7 +4,6 @@
 
 #include <assert.h>
 #include <cstring>
-#include <fstream>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -12,86 +11,393 @@
 #include <iomanip>
 #include <cstdint>
 #include <chrono>
+#include <vector>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#include "xrt.h"
-#include "experimental/xrt_kernel.h"
+#include "fft_engine.hpp"
 
-#define NSAMPLES 1024
+#define NUM_SLOTS 2 // double buffering: one slot in flight while the other is read back
 
-int main(int argc, char** argv) {
-    // Get npoints from argv
-    auto NPOINTS = 8;
-    if ( argc == 2 ) {
-        NPOINTS = std::stoi(argv[1]);
-    }
-    std::cout << "Load the point size " << NPOINTS << "*" << NSAMPLES << std::endl;
+// Output streams of stage two (host Makefile OUT_STREAMS), one s2mm each
+#ifndef FFT_OUT_STREAMS
+#define FFT_OUT_STREAMS 1
+#endif
 
-    // Get device index and download xclbin
-    std::cout << "Open the device" << std::endl;
-    auto device = xrt::device(0);
-    std::string binaryFile = "./fft.xclbin";
-    std::cout << "Load the xclbin " << binaryFile << std::endl;
-    auto uuid = device.load_xclbin(binaryFile);
+// Sample type of the graph (host Makefile DTYPE). The wider types run stage
+// two as S2_SPLIT kernels, each draining its slice of every frame through its
+// own s2mm; the slices in order make up the frame.
+#if defined(FFT_DTYPE_cint32)
+typedef int32_t sample_t;
+#elif defined(FFT_DTYPE_cfloat)
+typedef float sample_t;
+#else
+typedef int16_t sample_t;
+#endif
 
-    // Read generated data
-    auto *sample_vector = new int16_t [NPOINTS * NSAMPLES][2];
-    auto *fft_result = new int16_t [NPOINTS * NSAMPLES][2];
+using clock_type = std::chrono::high_resolution_clock;
 
-    std::ifstream infile("DataInFFT0.txt");
-    for (int i = 0; i < NPOINTS * NSAMPLES; i++) {
-        infile >> sample_vector[i][0] >> sample_vector[i][1];
+// Samples travel as raw binary: interleaved re/im of the sample type, frame
+// after frame, in the layout mm2s reads and s2mm writes. convert.exe turns
+// the text files of the simulator and the notebook into this format and back.
+// The input frames are registered with the engine as a user-pointer BO, which
+// XRT pins for the DMA: the mapping is page aligned and writable (a private,
+// copy-on-write mapping; the file itself is never written).
+static void *map_file(const std::string &name, size_t &size) {
+    int fd = open(name.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        std::cerr << "cannot open " << name << std::endl;
+        return nullptr;
     }
-    infile.close();
-
-    size_t samples_size = sizeof(int16_t) * NSAMPLES * 2; // 32 * 1024
-
-    // Start timer
-    auto start_time = std::chrono::high_resolution_clock::now();
-
-    // mm2s -> aie
-    // Get reference to the kernels
-    auto dm_in = xrt::kernel(device, uuid, "mm2s:{mm2s_fft_0}");
+    size = st.st_size;
+    void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    close(fd);
+    return p == MAP_FAILED ? nullptr : p;
+}
 
-    // Allocating the input size of sizeIn to MM2S
-    auto in_buff = xrt::bo(device, NPOINTS * samples_size, dm_in.group_id(0));
-
-    // aie -> s2mm
-    auto dm_out = xrt::kernel(device, uuid, "s2mm:{s2mm_fft_0}");
-    auto out_buff = xrt::bo(device, NPOINTS * samples_size, dm_out.group_id(0)); // 32 * 8 * 1024
+static bool write_all(int fd, const void *data, size_t size) {
+    while (size > 0) {
+        ssize_t w = write(fd, data, size);
+        if (w < 0) return false;
+        data = (const char *)data + w;
+        size -= w;
+    }
+    return true;
+}
 
-    // Write data to compute unit buffers
-    in_buff.write(sample_vector);
+template<typename S>
+int run(int argc, char** argv) {
+    // Usage: host.exe [npoints] [nframes] [frames_per_run] [instances] [rr|depth] [input] [output] [tile|natural] [stream|natural|real] [none|hann|blackman] [hop] [forward|inverse|filter] [out_shift|shift] [complex|power|db] [average] [band_lo] [band_hi]
+    auto NPOINTS = 8;
+    if ( argc >= 2 ) {
+        NPOINTS = std::stoi(argv[1]);
+    }
+    // Frames streamed through the graph; 1 is the original one-shot run
+    auto NFRAMES = 1;
+    if ( argc >= 3 ) {
+        NFRAMES = std::stoi(argv[2]);
+    }
+    // Frames moved by a single mm2s/s2mm run
+    auto BATCH = 1;
+    if ( argc >= 4 ) {
+        BATCH = std::stoi(argv[3]);
+    }
+    // Graph instances in the xclbin (make INSTANCES=<n>), each with its own data movers
+    auto NINST = 1;
+    if ( argc >= 5 ) {
+        NINST = std::stoi(argv[4]);
+    }
+    // Dispatch: rr hands run k to instance k % instances, depth to the
+    // instance with the fewest runs still executing
+    std::string policy = "rr";
+    if ( argc >= 6 ) {
+        policy = argv[5];
+    }
+    // Frame f of the stream is frame f % (frames in the file) of the input;
+    // every output frame is appended to the output file (/dev/null drops them)
+    std::string in_name = "DataInFFT0.bin", out_name = "DataOutFFT0.bin";
+    if ( argc >= 7 ) {
+        in_name = argv[6];
+    }
+    if ( argc >= 8 ) {
+        out_name = argv[7];
+    }
+    // Input layout: tile-major (the stride-8 subsequences one after the
+    // other, as the notebook writes them) or the plain signal
+    std::string order = "tile";
+    if ( argc >= 9 ) {
+        order = argv[8];
+    }
+    // Output layout: bins in the order stage two streams them, in natural
+    // frequency order, or (real) the half spectra A|B of the two real
+    // signals each input frame carries as re = a, im = b
+    std::string out_order = "stream";
+    if ( argc >= 10 ) {
+        out_order = argv[9];
+    }
+    // Window the AIE applies before the transform
+    std::string window = "none";
+    if ( argc >= 11 ) {
+        window = argv[10];
+    }
+    // STFT hop in samples, 0 off: the input file is one continuous signal
+    // (natural order) consumed hop samples per frame, each output frame the
+    // spectrum of the last NPOINTS*NSAMPLES samples
+    auto HOP = 0;
+    if ( argc >= 12 ) {
+        HOP = std::stoi(argv[11]);
+    }
+#ifdef FFT_CONV
+    // Convolution xclbin (make CONV=1): the filter spectrum file, npoints*NSAMPLES
+    // bins in natural order as re/im pairs of int16 (float for cfloat), and the
+    // shift of the products; without a file the filter passes the signal through
+    std::string filter_name;
+    auto SHIFT = -1;
+    if ( argc >= 13 ) {
+        filter_name = argv[12];
+    }
+    if ( argc >= 14 ) {
+        SHIFT = std::stoi(argv[13]);
+    }
+#else
+    // Direction of the transform (inverse: N * IDFT) and the right shift of
+    // the results, 13 for the 1/N of 8K
+    std::string direction = "forward";
+    auto OUT_SHIFT = 0;
+    if ( argc >= 13 ) {
+        direction = argv[12];
+    }
+    if ( argc >= 14 ) {
+        OUT_SHIFT = std::stoi(argv[13]);
+    }
+    if ( direction != "forward" && direction != "inverse" ) {
+        std::cerr << "direction must be forward or inverse" << std::endl;
+        return 1;
+    }
+    // What the 8K stage two sends: complex bins, the power of every bin as
+    // bfloat16 (convert.exe bin2txt ... bfloat16) or its dB value as int16
+    // (1/128 dB); a Welch build (make WELCH=1)
+    // writes one output frame per AVERAGE input frames, their mean power
+    std::string output = "complex";
+    auto AVERAGE = 1;
+    if ( argc >= 15 ) {
+        output = argv[14];
+    }
+    if ( argc >= 16 ) {
+        AVERAGE = std::stoi(argv[15]);
+    }
+    if ( output != "complex" && output != "power" && output != "db" ) {
+        std::cerr << "output must be complex, power or db" << std::endl;
+        return 1;
+    }
+    // Only the bins BAND_LO ... BAND_HI-1 of the 8K spectrum, in natural
+    // order (multiples of 4, complex output); BAND_HI 0 is the whole spectrum
+    auto BAND_LO = 0, BAND_HI = 0;
+    if ( argc >= 17 ) {
+        BAND_LO = std::stoi(argv[16]);
+    }
+    if ( argc >= 18 ) {
+        BAND_HI = std::stoi(argv[17]);
+    }
+#endif
+    if ( order != "tile" && order != "natural" ) {
+        std::cerr << "input order must be tile or natural" << std::endl;
+        return 1;
+    }
+    if ( out_order != "stream" && out_order != "natural" && out_order != "real" ) {
+        std::cerr << "output order must be stream, natural or real" << std::endl;
+        return 1;
+    }
+#ifndef FFT_REAL
+    if ( out_order == "real" ) {
+        std::cerr << "the real output order needs an s2mm built with REAL=1" << std::endl;
+        return 1;
+    }
+#endif
+    if ( window != "none" && window != "hann" && window != "blackman" ) {
+        std::cerr << "window must be none, hann or blackman" << std::endl;
+        return 1;
+    }
+    if ( NFRAMES < 1 || BATCH < 1 ) {
+        std::cerr << "nframes and frames_per_run must be positive" << std::endl;
+        return 1;
+    }
+    if ( NINST < 1 || (policy != "rr" && policy != "depth") ) {
+        std::cerr << "instances must be positive, dispatch rr or depth" << std::endl;
+        return 1;
+    }
+    std::cout << "Load the point size " << NPOINTS << "*" << NSAMPLES << std::endl;
+    std::cout << "Stream " << NFRAMES << " frame(s), " << BATCH << " per run, over "
+              << NINST << " instance(s) (" << policy << ")" << std::endl;
+    if ( HOP > 0 ) {
+        std::cout << "Spectrogram, one frame every " << HOP << " samples" << std::endl;
+    }
 
-    // Synchronize input buffers data to device global memory
-    in_buff.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+    // Open the device, download the xclbin and allocate the buffer pool
+    fft_engine_config cfg;
+    cfg.npoints = NPOINTS;
+    cfg.instances = NINST;
+    cfg.frames_per_run = BATCH;
+    cfg.slots = NUM_SLOTS;
+    cfg.dispatch = policy == "depth" ? fft_dispatch::depth : fft_dispatch::rr;
+    cfg.natural_order = order == "natural";
+    cfg.natural_output = out_order == "natural";
+    cfg.real_pairs = out_order == "real";
+    cfg.window = window == "hann" ? 1 : window == "blackman" ? 2 : 0;
+    cfg.hop = HOP;
+    cfg.out_streams = FFT_OUT_STREAMS;
+#ifdef FFT_MULTI
+    // Multichannel xclbin (make MULTI=1): every frame is eight channels of
+    // NSAMPLES samples in tile order, every output frame their spectra
+    cfg.multi = true;
+    std::cout << "Eight independent " << NSAMPLES << "-point transforms per frame" << std::endl;
+#endif
+#ifdef FFT_CONV
+    cfg.conv = true;
+#else
+    cfg.inverse = direction == "inverse";
+    cfg.out_shift = OUT_SHIFT;
+    if ( cfg.inverse || OUT_SHIFT ) {
+        std::cout << (cfg.inverse ? "Inverse" : "Forward") << " transform, results shifted right by "
+                  << OUT_SHIFT << std::endl;
+    }
+    cfg.output_mode = output == "power" ? 1 : output == "db" ? 2 : 0;
+    cfg.average = AVERAGE;
+#ifdef FFT_WELCH
+    cfg.welch = true;
+#endif
+    if ( cfg.output_mode ) {
+        std::cout << "Output " << output << ", averaged over " << AVERAGE << " frame(s)" << std::endl;
+    }
+    cfg.band_lo = BAND_LO;
+    cfg.band_hi = BAND_HI;
+    if ( BAND_HI ) {
+        std::cout << "Bins " << BAND_LO << " ... " << BAND_HI - 1 << " only" << std::endl;
+    }
+#endif
+    std::cout << "Load the xclbin " << cfg.xclbin << std::endl;
+    FftEngine<S> engine(cfg);
+#ifdef FFT_CONV
+    using coeff = typename FftEngine<S>::coeff;
+    size_t filter_values = 2 * NPOINTS * NSAMPLES;
+    std::vector<coeff> pass;
+    const coeff *filter = nullptr;
+    if ( !filter_name.empty() ) {
+        size_t filter_size = 0;
+        filter = (const coeff *)map_file(filter_name, filter_size);
+        if (!filter || filter_size != filter_values * sizeof(coeff)) {
+            std::cerr << filter_name << " must hold " << filter_values / 2 << " filter bins" << std::endl;
+            return 1;
+        }
+    } else {
+        // H = 1 in Q14, or 1/N for cfloat: the output is the input frame
+        bool is_float = std::is_same<S, float>::value;
+        pass.assign(filter_values, 0);
+        for (size_t k = 0; k < filter_values; k += 2) {
+            pass[k] = is_float ? coeff(1.0 / (NPOINTS * NSAMPLES)) : coeff(1 << 14);
+        }
+        filter = pass.data();
+    }
+    if (SHIFT < 0) {
+#ifdef FFT_BFP
+        SHIFT = 14;
+#else
+        SHIFT = std::is_same<S, float>::value ? 0 : 27;
+#endif
+    }
+    std::cout << "Load the filter " << (filter_name.empty() ? "(pass)" : filter_name)
+              << ", shift " << SHIFT << std::endl;
+    engine.set_filter(filter, SHIFT);
+#endif
 
-    // Execute the compute units
-    auto run_dm_in = dm_in(in_buff, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, NPOINTS * NSAMPLES/4);
+    // Map the generated data
+    size_t frame_size = engine.frame_values() * sizeof(S);
+    size_t in_size = 0;
+    const S *in_file = (const S *)map_file(in_name, in_size);
+    if (!in_file || in_size == 0 || in_size % frame_size != 0) {
+        std::cerr << in_name << " must hold whole frames of " << frame_size << " bytes" << std::endl;
+        return 1;
+    }
+    int file_frames = in_size / frame_size;
+    // The mapping is handed to the engine as it is (a user-pointer buffer)
+    // and every run reads its window of it: no frame is copied on the host,
+    // unless the window of a run is not 4 KiB aligned (small frames or hops)
+    auto in_buffer = engine.register_frames(in_file, file_frames);
 
-    // Wait for kernels to complete
-    // run_dm_in.wait();
-    
-    auto run_dm_out = dm_out(out_buff, nullptr, NPOINTS * NSAMPLES/4);
-    run_dm_out.wait();
+    int out_fd = open(out_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd < 0) {
+        std::cerr << "cannot create " << out_name << std::endl;
+        return 1;
+    }
 
-    // Synchronize the output buffer data from the device
-    out_buff.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
+    // Start timer
+    auto start_time = clock_type::now();
 
-    // Read output buffer data to local buffer
-    out_buff.read(fft_result);
+    // Results are written in submission order, straight from the buffers
+    // s2mm filled, while later frames are in flight; submit() blocks while
+    // the whole pool is taken
+    std::deque<std::future<typename FftEngine<S>::result>> pending;
+    // (frames still being averaged come back empty)
+    typename FftEngine<S>::result last_frame;
+    bool write_ok = true;
+    int written = 0;
+    auto retire = [&]() {
+        auto y = pending.front().get();
+        pending.pop_front();
+        if (y.empty()) return;
+        last_frame = std::move(y);
+        written++;
+        write_ok = write_ok && write_all(out_fd, last_frame.data(), last_frame.size() * sizeof(S));
+    };
+    // frame f of the stream is file frame f % file_frames, a run ends at
+    // the end of the file
+    for (int f = 0; f < NFRAMES;) {
+        int first = f % file_frames, n = std::min({BATCH, file_frames - first, NFRAMES - f});
+        auto y = FftEngine<S>::runs_aligned(frame_size, first, n, BATCH) ?
+                 engine.submit(in_buffer, first, n) : engine.submit(in_file + first * frame_size / sizeof(S), n);
+        for (auto &r : y) pending.push_back(std::move(r));
+        f += n;
+        while ((int)pending.size() > NINST * NUM_SLOTS * BATCH) retire();
+    }
+    engine.flush();
+    while (!pending.empty()) retire();
 
     // Stop timer
-    auto end_time = std::chrono::high_resolution_clock::now();
+    auto end_time = clock_type::now();
 
-    // Output the data
-    std::ofstream outfile("DataOutFFT0.txt");
-    for (int i = 0; i < NPOINTS * NSAMPLES; i++) {
-        outfile << fft_result[i][0] << " " << fft_result[i][1] << std::endl;
+    close(out_fd);
+    if (!write_ok) {
+        std::cerr << "writing " << out_name << " failed" << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << written << " frame(s) to " << out_name << std::endl;
+#ifdef FFT_BFP
+    // spectrum = samples * 2^exponent, for the last frame (stream 0's
+    // trailer, every stream has its own); power and dB frames have the
+    // exponent folded in
+    size_t trailer = engine.trailer_index();
+    if ( !cfg.output_mode && !last_frame.empty() ) {
+        std::cout << "Block exponent: " << last_frame[trailer]
+                  << ", peak: " << last_frame[trailer + 1] << std::endl;
     }
-    outfile.close();
+#endif
 
+    auto stats = engine.get_statistics();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    // mean, min, p99 and max of the latencies (us)
+    auto report = [](const std::string &what, std::vector<double> &latency) {
+        std::sort(latency.begin(), latency.end());
+        double mean = 0;
+        for (auto l : latency) mean += l;
+        mean /= latency.size();
+        std::cout << what << " (us): mean " << mean
+                  << ", min " << latency.front() << ", p99 " << latency[latency.size() * 99 / 100]
+                  << ", max " << latency.back() << std::endl;
+    };
+    if (NFRAMES > 1) {
+        double seconds = std::chrono::duration<double>(end_time - start_time).count();
+        std::cout << "Throughput: " << std::fixed << std::setprecision(1) << NFRAMES / seconds << " frames/s" << std::endl;
+        if (NINST > 1) {
+            std::cout << "Frames per instance:";
+            for (int i = 0; i < NINST; i++) std::cout << " " << stats.frames[i];
+            std::cout << std::endl;
+        }
+        // a frame waits for the rest of its run: its own submission to the
+        // delivery of its result, and the run's from its first frame
+        report("Latency per frame", stats.frame_latency_us);
+        report("Latency per run of " + std::to_string(BATCH) + " frame(s)", stats.run_latency_us);
+    }
     std::cout << "TEST PASSED (" << duration.count() << " us)" << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char** argv) {
+    return run<sample_t>(argc, argv);
+}
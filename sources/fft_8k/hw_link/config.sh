@@ -0,0 +1,65 @@
+#!/bin/sh
+# Copyright (C) 2023 Advanced Micro Devices, Inc
+#
+# SPDX-License-Identifier: MIT
+
+# Link configuration of a replicated design:
+#     config.sh <instances> <s2mm per instance> > config_multi.cfg
+# Instance k is fed by mm2s_fft_k through DataInFFT<8k> ... DataInFFT<8k+7>
+# and drains DataOutFFT<k*s> ... into s2mm_fft_<k*s> ... (s: s2mm per
+# instance, the OUT_STREAMS of the graph; 2 for the split wider types built
+# with one). config.sh 1 1 and config.sh 1 2 give config.cfg and
+# config_split.cfg, config.sh 1 8 the eight-stream design.
+
+N=${1:-1}
+S=${2:-1}
+
+names() {
+    i=0
+    while [ $i -lt $2 ]; do
+        [ $i -gt 0 ] && printf '.'
+        printf '%s_%d' $1 $i
+        i=$((i + 1))
+    done
+}
+
+cat <<HDR
+# Copyright (C) 2023 Advanced Micro Devices, Inc
+#
+# SPDX-License-Identifier: MIT
+
+# generated by config.sh $N $S
+[connectivity]
+# Kernels
+nk=mm2s:$N:$(names mm2s_fft $N)
+nk=s2mm:$((N * S)):$(names s2mm_fft $((N * S)))
+HDR
+
+k=0
+while [ $k -lt $N ]; do
+    echo
+    t=0
+    while [ $t -lt 8 ]; do
+        echo "stream_connect=mm2s_fft_$k.s$t:ai_engine_0.DataInFFT$((k * 8 + t))"
+        t=$((t + 1))
+    done
+    echo
+    h=0
+    while [ $h -lt $S ]; do
+        q=$((k * S + h))
+        echo "stream_connect=ai_engine_0.DataOutFFT$q:s2mm_fft_$q.s"
+        h=$((h + 1))
+    done
+    k=$((k + 1))
+done
+
+cat <<TLR
+
+[advanced]
+param=compiler.errorOnHoldViolation=false
+# Disable Profiling in hw_emu so that it is faster...
+# param=hw_emu.enableProfiling=false
+
+[vivado]
+prop=run.impl_1.strategy=Performance_NetDelay_low
+TLR
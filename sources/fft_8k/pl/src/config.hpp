@@ -7,4 +7,30 @@
 #include <ap_axi_sdata.h>
 
 #define DWIDTH 128
+#define NUM_TILES 8
+// 4 for cint16, 8 for cint32 and cfloat (the Makefile derives it from DTYPE)
+#ifndef SAMPLE_BYTES
+#define SAMPLE_BYTES 4
+#endif
+#define TILE_BEATS (1024 * SAMPLE_BYTES * 8 / DWIDTH) // 1024 samples per stage-one tile
+#define FRAME_BEATS (NUM_TILES * TILE_BEATS)
+#define SAMPLE_BITS (SAMPLE_BYTES * 8)
+#define WIDE_DWIDTH 512 // natural-order input port
+// the wider types split stage two and drain each frame through two s2mm
+#define S2_SPLIT (SAMPLE_BYTES / 4)
+// output streams of stage two (Makefile OUT_STREAMS, as the graph was built):
+// S2_KERNELS slices of the bins, S2_STREAMS streams per slice, one s2mm each
+#ifndef FFT_OUT_STREAMS
+#define FFT_OUT_STREAMS 1
+#endif
+#define S2_KERNELS (S2_SPLIT > FFT_OUT_STREAMS / 2 ? S2_SPLIT : FFT_OUT_STREAMS / 2)
+#define S2_STREAMS (FFT_OUT_STREAMS > S2_KERNELS ? FFT_OUT_STREAMS / S2_KERNELS : 1)
+#define S2_OUTPUTS (S2_KERNELS * S2_STREAMS)
+// block-floating-point graph (Makefile BFP=1): each stage-two block ends
+// with 2 beats, the first sample being {exponent, peak}
+#ifdef FFT_BFP
+#define TRAILER_BEATS 2
+#else
+#define TRAILER_BEATS 0
+#endif
 typedef qdma_axis<DWIDTH, 0, 0, 0> data;
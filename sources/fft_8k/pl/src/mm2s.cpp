@@ -4,10 +4,146 @@
 
 #include "config.hpp"
 
+// Tile t of every frame, frame after frame. Each tile has its own memory
+// port and runs as its own dataflow process, so the eight stage-one tiles
+// are filled side by side: a frame takes TILE_BEATS cycles, not FRAME_BEATS.
+template<int t>
+static void read_tile(ap_int<DWIDTH>* mem, hls::stream<data >& s, int frames) {
+    for (int f = 0; f < frames; ++ f) {
+        for (int j = 0; j < TILE_BEATS; ++ j) {
+#pragma HLS PIPELINE II=1
+            data x;
+            x.data = mem[f * FRAME_BEATS + t * TILE_BEATS + j];
+            x.keep_all();
+            s.write(x);
+        }
+    }
+}
+
+static void read_tiles(
+    ap_int<DWIDTH>* mem0, ap_int<DWIDTH>* mem1, ap_int<DWIDTH>* mem2, ap_int<DWIDTH>* mem3,
+    ap_int<DWIDTH>* mem4, ap_int<DWIDTH>* mem5, ap_int<DWIDTH>* mem6, ap_int<DWIDTH>* mem7,
+    hls::stream<data >& s0, hls::stream<data >& s1, hls::stream<data >& s2, hls::stream<data >& s3,
+    hls::stream<data >& s4, hls::stream<data >& s5, hls::stream<data >& s6, hls::stream<data >& s7,
+    int frames) {
+#pragma HLS DATAFLOW
+    read_tile<0>(mem0, s0, frames);
+    read_tile<1>(mem1, s1, frames);
+    read_tile<2>(mem2, s2, frames);
+    read_tile<3>(mem3, s3, frames);
+    read_tile<4>(mem4, s4, frames);
+    read_tile<5>(mem5, s5, frames);
+    read_tile<6>(mem6, s6, frames);
+    read_tile<7>(mem7, s7, frames);
+}
+
+// Natural-order frames: tile t takes samples NUM_TILES*m+t. A block of
+// NUM_TILES beats (32 cint16 or 16 8-byte samples) holds beat j of every
+// tile, lane k of tile t being sample NUM_TILES*k+t of the block. The block
+// is read as whole WIDE_DWIDTH words, transposed in registers and written
+// to all eight streams at once, so the stride-8 gather costs no extra pass.
+#define BLOCK_WORDS (DWIDTH * NUM_TILES / WIDE_DWIDTH)
+#define BEAT_SAMPLES (DWIDTH / SAMPLE_BITS)
+#define FRAME_BLOCKS TILE_BEATS // blocks of a frame
+
+typedef ap_uint<DWIDTH * NUM_TILES> block_t;
+
+static block_t read_block(ap_int<WIDE_DWIDTH>* mem, int b) {
+    block_t block;
+    for (int w = 0; w < BLOCK_WORDS; ++ w) {
+        block.range((w + 1) * WIDE_DWIDTH - 1, w * WIDE_DWIDTH) = mem[b * BLOCK_WORDS + w];
+    }
+    return block;
+}
+
+static void write_block(
+    block_t block,
+    hls::stream<data >& s0, hls::stream<data >& s1, hls::stream<data >& s2, hls::stream<data >& s3,
+    hls::stream<data >& s4, hls::stream<data >& s5, hls::stream<data >& s6, hls::stream<data >& s7) {
+#pragma HLS INLINE
+    data x[NUM_TILES];
+    for (int t = 0; t < NUM_TILES; ++ t) {
+        for (int k = 0; k < BEAT_SAMPLES; ++ k) {
+            int i = NUM_TILES * k + t;
+            x[t].data.range((k + 1) * SAMPLE_BITS - 1, k * SAMPLE_BITS) = block.range((i + 1) * SAMPLE_BITS - 1, i * SAMPLE_BITS);
+        }
+        x[t].keep_all();
+    }
+    s0.write(x[0]);
+    s1.write(x[1]);
+    s2.write(x[2]);
+    s3.write(x[3]);
+    s4.write(x[4]);
+    s5.write(x[5]);
+    s6.write(x[6]);
+    s7.write(x[7]);
+}
+
+static void read_natural(
+    ap_int<WIDE_DWIDTH>* mem,
+    hls::stream<data >& s0, hls::stream<data >& s1, hls::stream<data >& s2, hls::stream<data >& s3,
+    hls::stream<data >& s4, hls::stream<data >& s5, hls::stream<data >& s6, hls::stream<data >& s7,
+    int frames) {
+    for (int b = 0; b < frames * FRAME_BLOCKS; ++ b) {
+#pragma HLS PIPELINE II=BLOCK_WORDS
+        write_block(read_block(mem, b), s0, s1, s2, s3, s4, s5, s6, s7);
+    }
+}
+
+// STFT: a continuous natural-order signal, one frame every hop_blocks
+// blocks. The last FRAME_BLOCKS blocks stay in an on-chip ring that
+// outlives the call, so the signal may arrive over many runs and memory
+// only supplies the hop_blocks new blocks of a frame; the whole window is
+// then streamed from the ring, oldest block first. start clears the ring:
+// the first frames of a signal see zeros before its first sample.
+static void read_stft(
+    ap_int<WIDE_DWIDTH>* mem,
+    hls::stream<data >& s0, hls::stream<data >& s1, hls::stream<data >& s2, hls::stream<data >& s3,
+    hls::stream<data >& s4, hls::stream<data >& s5, hls::stream<data >& s6, hls::stream<data >& s7,
+    int frames, int hop_blocks, int start) {
+    static block_t ring[FRAME_BLOCKS];
+    static int head = 0; // oldest block
+    if (start) {
+        for (int b = 0; b < FRAME_BLOCKS; ++ b) {
+#pragma HLS PIPELINE II=1
+            ring[b] = 0;
+        }
+        head = 0;
+    }
+    for (int f = 0; f < frames; ++ f) {
+        for (int b = 0; b < hop_blocks; ++ b) {
+#pragma HLS PIPELINE II=BLOCK_WORDS
+            ring[head] = read_block(mem, f * hop_blocks + b);
+            head = head == FRAME_BLOCKS - 1 ? 0 : head + 1;
+        }
+        for (int b = 0; b < FRAME_BLOCKS; ++ b) {
+#pragma HLS PIPELINE II=1
+            int k = head + b;
+            write_block(ring[k < FRAME_BLOCKS ? k : k - FRAME_BLOCKS], s0, s1, s2, s3, s4, s5, s6, s7);
+        }
+    }
+}
+
 extern "C" {
 
+// natural = 0: mem0 ... mem7 all point at the same buffer of tile-major
+// frames (tile t = the stride-NUM_TILES subsequence t). natural = 1: wide
+// points at frames in natural sample order. size counts 128-bit beats and
+// spans whole frames.
+// hop > 0 (STFT, natural order): wide points at hop new samples per frame,
+// hop a multiple of a block (NUM_TILES beats) and at most a frame; each
+// frame is the last frame of samples of the signal, start = 1 begins a new
+// signal (see read_stft).
 void mm2s(
-    ap_int<DWIDTH>* mem, 
+    ap_int<DWIDTH>* mem0,
+    ap_int<DWIDTH>* mem1,
+    ap_int<DWIDTH>* mem2,
+    ap_int<DWIDTH>* mem3,
+    ap_int<DWIDTH>* mem4,
+    ap_int<DWIDTH>* mem5,
+    ap_int<DWIDTH>* mem6,
+    ap_int<DWIDTH>* mem7,
+    ap_int<WIDE_DWIDTH>* wide,
     hls::stream<data >& s0, 
     hls::stream<data >& s1, 
     hls::stream<data >& s2, 
@@ -16,7 +152,19 @@ void mm2s(
     hls::stream<data >& s5, 
     hls::stream<data >& s6, 
     hls::stream<data >& s7,
-    int size) {
+    int size,
+    int natural,
+    int hop,
+    int start) {
+#pragma HLS interface m_axi port=mem0 offset=slave bundle=gmem0 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem1 offset=slave bundle=gmem1 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem2 offset=slave bundle=gmem2 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem3 offset=slave bundle=gmem3 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem4 offset=slave bundle=gmem4 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem5 offset=slave bundle=gmem5 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem6 offset=slave bundle=gmem6 max_read_burst_length=256
+#pragma HLS interface m_axi port=mem7 offset=slave bundle=gmem7 max_read_burst_length=256
+#pragma HLS interface m_axi port=wide offset=slave bundle=gmem8 max_read_burst_length=64
 #pragma HLS interface axis port=s0
 #pragma HLS interface axis port=s1
 #pragma HLS interface axis port=s2
@@ -25,23 +173,14 @@ void mm2s(
 #pragma HLS interface axis port=s5
 #pragma HLS interface axis port=s6
 #pragma HLS interface axis port=s7
-    data x;
+    int frames = size / FRAME_BEATS;
 
-    for (int i = 0; i < size; ++ i) {
-#pragma HLS PIPELINE II=1
-        x.data = mem[i];
-        x.keep_all();
-
-        switch(i / 256) {
-        case 0:s0.write(x);break;
-        case 1:s1.write(x);break;
-        case 2:s2.write(x);break;
-        case 3:s3.write(x);break;
-        case 4:s4.write(x);break;
-        case 5:s5.write(x);break;
-        case 6:s6.write(x);break;
-        case 7:s7.write(x);break;
-        }
+    if (hop > 0) {
+        read_stft(wide, s0, s1, s2, s3, s4, s5, s6, s7, frames, hop / (NUM_TILES * BEAT_SAMPLES), start);
+    } else if (natural) {
+        read_natural(wide, s0, s1, s2, s3, s4, s5, s6, s7, frames);
+    } else {
+        read_tiles(mem0, mem1, mem2, mem3, mem4, mem5, mem6, mem7, s0, s1, s2, s3, s4, s5, s6, s7, frames);
     }
 }
-}
\ No newline at end of file
+}
@@ -4,14 +4,209 @@
 
 #include "config.hpp"
 
+// Stage two streams 4 bins of one row at a time. Output o is stream
+// g = o / S2_KERNELS of kernel h = o % S2_KERNELS; it carries STREAM_ROWS
+// rows, stream sample (i*STREAM_ROWS+q)*4+l holding bin
+// 1024(g*STREAM_ROWS+q) + h*BINS + 4i + l. VEC_BEATS beats carry those 4 bins.
+#define SAMPLES_PER_BEAT (DWIDTH / SAMPLE_BITS)
+#define VEC_BEATS (4 / SAMPLES_PER_BEAT)
+#define ROW_BEATS (1024 / SAMPLES_PER_BEAT)      // one row of the 8x1024 output
+#define STREAM_ROWS (NUM_TILES / S2_STREAMS)
+#define SLICE_BEATS (FRAME_BEATS / S2_OUTPUTS)   // data beats of a frame in one stream
+#define STREAM_BEATS (SLICE_BEATS + TRAILER_BEATS)
+#define HALF_BEATS (FRAME_BEATS / 2)             // bins 0 ... N/2 - 1
+#define PART_BITS (SAMPLE_BITS / 2)
+
+// output_mode of stage two: complex samples, or a 16-bit power (bfloat16) or
+// dB value per bin; these put groups i and i+1 of a row in one beat, 8 bins.
+#define OUT_COMPLEX 0
+#define OUT_POWER 1
+#define OUT_DB 2
+
+// beats of a group of bins, of a row, of the part of a row one slice holds,
+// of a frame in one stream and with the trailer, in output mode M
+template<int M> struct geometry {
+    static const int GROUP = M == OUT_COMPLEX ? VEC_BEATS : 1;
+    static const int ROW = M == OUT_COMPLEX ? ROW_BEATS : 1024 / 8;
+    static const int RUN = ROW / S2_KERNELS;
+    static const int FRAME = NUM_TILES * ROW;
+    static const int SLICE = FRAME / S2_OUTPUTS;
+    static const int STREAM = SLICE + TRAILER_BEATS;
+};
+
+// Position of stream beat j in the frame buffer: natural bin order within
+// the stream's rows (row after row), the trailer after the data
+template<int M>
+static int buffer_index(int j, int natural) {
+    typedef geometry<M> G;
+    if (!natural || j >= G::SLICE) return j;
+    int r = j % G::GROUP, q = (j / G::GROUP) % STREAM_ROWS, i = j / (G::GROUP * STREAM_ROWS);
+    return q * G::RUN + i * G::GROUP + r;
+}
+
+// Output beat of frame buffer entry k. Natural order: the slices of a row
+// interleave, trailers follow all bins. Otherwise the streams of a frame are
+// stored one after the other, each with its trailer, as they were streamed.
+template<int M>
+static int frame_offset(int k, int slice, int natural) {
+    typedef geometry<M> G;
+    if (!natural) return slice * G::STREAM + k;
+    if (k >= G::SLICE) return G::FRAME + slice * TRAILER_BEATS + k - G::SLICE;
+    int row = (slice / S2_KERNELS) * STREAM_ROWS + k / G::RUN;
+    return row * G::ROW + (slice % S2_KERNELS) * G::RUN + k % G::RUN;
+}
+
+// A band of bins lo ... hi - 1 (multiples of 4, stage two's band_lo/band_hi):
+// every stream sends the groups of the band in its rows, row after row in
+// natural order, so they go straight to their place in the band, followed
+// by its trailer. A band frame holds the bins, then the trailers of all streams.
+#define ROW_GROUPS (1024 / 4)
+#define RUN_GROUPS (ROW_GROUPS / S2_KERNELS)
+
+static void band_mover(ap_int<DWIDTH>* mem, hls::stream<data >& s, int size, int slice, int lo, int hi) {
+    int first[STREAM_ROWS], last[STREAM_ROWS];
+    int beats = TRAILER_BEATS;
+    for (int t = 0; t < STREAM_ROWS; t++) {
+        int q = (slice / S2_KERNELS) * STREAM_ROWS + t;
+        int a = (slice % S2_KERNELS) * RUN_GROUPS, b = a + RUN_GROUPS;
+        if (lo / 4 - q * ROW_GROUPS > a) a = lo / 4 - q * ROW_GROUPS;
+        if (hi / 4 - q * ROW_GROUPS < b) b = hi / 4 - q * ROW_GROUPS;
+        first[t] = q * ROW_GROUPS + a - lo / 4;
+        last[t] = b > a ? q * ROW_GROUPS + b - lo / 4 : first[t];
+        beats += (last[t] - first[t]) * VEC_BEATS;
+    }
+    int bins = (hi - lo) / 4 * VEC_BEATS;
+    int frame = bins + S2_OUTPUTS * TRAILER_BEATS;
+
+    for (int f = 0; f < size / beats; f++) {
+        for (int t = 0; t < STREAM_ROWS; t++) {
+            for (int j = first[t] * VEC_BEATS; j < last[t] * VEC_BEATS; j++) {
+                #pragma HLS PIPELINE II=1
+                #pragma HLS LOOP_TRIPCOUNT min=VEC_BEATS max=SLICE_BEATS
+                mem[f * frame + j] = s.read().data;
+            }
+        }
+        for (int j = 0; j < TRAILER_BEATS; j++) {
+            #pragma HLS PIPELINE II=1
+            mem[f * frame + bins + slice * TRAILER_BEATS + j] = s.read().data;
+        }
+    }
+}
+
+#ifdef FFT_REAL
+static_assert(S2_OUTPUTS == 1, "the real split needs the whole spectrum in one s2mm (cint16, OUT_STREAMS 1)");
+
+// Two-for-one real transform: the host packs two real signals a, b into one
+// complex frame z = a + jb, and with Z its spectrum the split writes
+//     A[k] = (Z[k] + conj(Z[N-k])) / 2,  B[k] = (Z[k] - conj(Z[N-k])) / 2j
+// for k < N/2, A then B. Bins 0 and N/2 of A and B are real; bin N/2 takes
+// the imaginary part of bin 0, so a split frame is as large as a complex one.
+// Output beat j takes Z from beat jj = j % HALF_BEATS and Z[N-k] mirrored from
+// beat FRAME_BEATS - jj (lane 0, lo) and FRAME_BEATS - 1 - jj (the others, hi).
+typedef ap_int<PART_BITS> part_t;
+typedef ap_int<PART_BITS + 1> wide_t;
+
+static part_t re(ap_int<DWIDTH> v, int l) { return v.range(l * SAMPLE_BITS + PART_BITS - 1, l * SAMPLE_BITS); }
+static part_t im(ap_int<DWIDTH> v, int l) { return v.range(l * SAMPLE_BITS + SAMPLE_BITS - 1, l * SAMPLE_BITS + PART_BITS); }
+
+// nyq: bin N/2 of Z, captured while the frame was gathered
+static ap_int<DWIDTH> split_beat(ap_int<DWIDTH> z, ap_int<DWIDTH> lo, ap_int<DWIDTH> hi, ap_int<SAMPLE_BITS> nyq, int j) {
+    bool b = j >= HALF_BEATS, first = j % HALF_BEATS == 0;
+    ap_int<DWIDTH> y;
+    for (int l = 0; l < SAMPLES_PER_BEAT; l++) {
+        #pragma HLS UNROLL
+        ap_int<DWIDTH> m = l == 0 ? lo : hi;
+        int ml = l == 0 ? 0 : SAMPLES_PER_BEAT - l;
+        wide_t zr = re(z, l), zi = im(z, l), mr = re(m, ml), mi = im(m, ml);
+        part_t yr, yi;
+        if (first && l == 0) {
+            yr = b ? zi : zr;
+            yi = b ? nyq.range(SAMPLE_BITS - 1, PART_BITS) : nyq.range(PART_BITS - 1, 0);
+        } else if (!b) {
+            yr = (zr + mr) >> 1;
+            yi = (zi - mi) >> 1;
+        } else {
+            yr = (zi + mi) >> 1;
+            yi = (mr - zr) >> 1;
+        }
+        y.range(l * SAMPLE_BITS + PART_BITS - 1, l * SAMPLE_BITS) = yr;
+        y.range(l * SAMPLE_BITS + SAMPLE_BITS - 1, l * SAMPLE_BITS + PART_BITS) = yi;
+    }
+    return y;
+}
+#endif
+
 extern "C" {
 
-void s2mm(ap_int<DWIDTH>* mem, hls::stream<data >& s, int size) {
+// slice: output stream o of every frame (s2mm_fft_o of a multi-stream stage two;
+// 0 otherwise). All streams of a run write the same buffer, frame f at
+// f * S2_OUTPUTS * (beats of a stream and frame).
+// order = 0 stores the streams as they arrive, 1 the bins in natural
+// frequency order: each frame is gathered in an on-chip buffer and written
+// out in bursts of a row's slice. 2 writes the two-for-one split of the natural
+// spectrum (FFT_REAL builds only, see split_beat).
+// mode: the output_mode stage two runs with; power and dB frames are smaller,
+// in either order. size counts the beats of this stream.
+// band_lo, band_hi: the band stage two computes; anything but 0 and the frame
+// size takes the band layout of band_mover (complex bins, order ignored).
+void s2mm(ap_int<DWIDTH>* mem, hls::stream<data >& s, int size, int slice, int order, int mode,
+          int band_lo, int band_hi) {
+    if (band_lo > 0 || band_hi < NUM_TILES * 1024) {
+        band_mover(mem, s, size, slice, band_lo, band_hi);
+        return;
+    }
+
+    // ping-pong: frame f is gathered while frame f - 1 is written out
+    ap_int<DWIDTH> buf[2][STREAM_BEATS];
+#pragma HLS ARRAY_PARTITION variable=buf dim=1 complete
+#pragma HLS DEPENDENCE variable=buf inter false
+    int beats = mode == OUT_POWER ? geometry<OUT_POWER>::STREAM : mode == OUT_DB ? geometry<OUT_DB>::STREAM : STREAM_BEATS;
+    int frames = size / beats;
+    int natural = order != 0;
+#ifdef FFT_REAL
+    // the split reads Z[k] and Z[N-k] in one beat: the upper half of the
+    // frame is also kept mirrored here (mir[jj] = beat FRAME_BEATS-1-jj), so
+    // every bank takes one read and one write an iteration and II stays 1
+    ap_int<DWIDTH> mir[2][HALF_BEATS];
+#pragma HLS ARRAY_PARTITION variable=mir dim=1 complete
+#pragma HLS DEPENDENCE variable=mir inter false
+    ap_int<SAMPLE_BITS> nyq[2];
+    ap_int<DWIDTH> lo = 0;
+#endif
+
 data_mover:
-    for (int i = 0; i < size; i++) {
-        #pragma HLS PIPELINE II=1 // pipeline
-        data x = s.read();
-        mem[i] = x.data;
+    for (int f = 0; f <= frames; f++) {
+        for (int j = 0; j < beats; j++) {
+            #pragma HLS PIPELINE II=1 // pipeline
+            #pragma HLS LOOP_TRIPCOUNT min=STREAM_BEATS/4 max=STREAM_BEATS
+            if (f < frames) {
+                data x = s.read();
+                int k = mode == OUT_POWER ? buffer_index<OUT_POWER>(j, natural) :
+                        mode == OUT_DB ? buffer_index<OUT_DB>(j, natural) : buffer_index<OUT_COMPLEX>(j, natural);
+                buf[f % 2][k] = x.data;
+#ifdef FFT_REAL
+                if (k == HALF_BEATS) nyq[f % 2] = x.data.range(SAMPLE_BITS - 1, 0);
+                if (order == 2 && k >= HALF_BEATS && k < FRAME_BEATS) mir[f % 2][FRAME_BEATS - 1 - k] = x.data;
+#endif
+            }
+            if (f > 0) {
+#ifdef FFT_REAL
+                bool split = order == 2 && j < FRAME_BEATS;
+                int jj = j % HALF_BEATS;
+                ap_int<DWIDTH> y = buf[(f - 1) % 2][split ? jj : j];
+                if (split) {
+                    ap_int<DWIDTH> hi = mir[(f - 1) % 2][jj];
+                    y = split_beat(y, lo, hi, nyq[(f - 1) % 2], j);
+                    lo = hi;
+                }
+#else
+                ap_int<DWIDTH> y = buf[(f - 1) % 2][j];
+#endif
+                int o = mode == OUT_POWER ? frame_offset<OUT_POWER>(j, slice, natural) :
+                        mode == OUT_DB ? frame_offset<OUT_DB>(j, slice, natural) : frame_offset<OUT_COMPLEX>(j, slice, natural);
+                mem[(f - 1) * S2_OUTPUTS * beats + o] = y;
+            }
+        }
     }
 }
 }
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+# Copyright (C) 2023 Advanced Micro Devices, Inc
+#
+# SPDX-License-Identifier: MIT
+
+"""Throughput/latency benchmark of the FFT graphs.
+
+For every size (1k, 4k, 8k) and simulator target (x86sim, aiesim) the graph
+is built with PROFILE=1 and ITER=<frames>, the simulator pushes <frames>
+copies of the design's test frame through it, and the results are taken from
+the simulator output:
+
+  aiesim  latency_ns        time stamp of the last sample of frame 0
+          interval_ns       mean spacing of the following frames
+          throughput_fps    1e9 / interval_ns
+          cycles_per_frame  interval_ns at the AIE clock (--aie-mhz)
+          kernel_cycles     mean FFT_PROFILE total of every kernel (first
+                            iteration dropped) and the slowest one
+          stall_cycles      cycles_per_frame - slowest kernel: time the
+                            bottleneck kernel spends waiting on its windows
+                            and streams
+  x86sim  wall_s, wall_ms_per_frame (functional model, for a sanity check)
+
+Both record frames_out, the frames found in the output. --board adds
+host.exe runs of the 8K xclbin (one per --batches entry, frames_per_run of
+the run) with their frames/s, mean latency per frame (latency_ns, from its
+submission) and per run (latency_run_ns, from the run's first frame).
+
+The results go to --out as JSON. With --baseline the numbers are compared to
+an earlier result file and the script exits with 1 when any of them is worse
+by more than --threshold (relative), so a kernel change is judged by
+measurement:
+
+    fft_bench.py --frames 16 --out bench.json
+    fft_bench.py --frames 16 --baseline bench_main.json --threshold 0.05
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+SOURCES = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAKE_TARGET = {"x86sim": "x86sim", "aiesim": "hw"}
+SIM_RULE = {"x86sim": "x86sim", "aiesim": "aieemu"}
+SIM_OUTPUT = {"x86sim": "x86simulator_output", "aiesim": "aiesimulator_output"}
+PROFILE = re.compile(r"FFT_PROFILE\s+(\S+)\s+(\d+)\s+(\d+).*\stotal=(\d+)")
+
+# metric: True if larger is better; only these take part in the regression check
+CHECKED = {
+    "latency_ns": False,
+    "interval_ns": False,
+    "cycles_per_frame": False,
+    "throughput_fps": True,
+    "frames_out": True,
+}
+
+
+def make(design, *args, capture=False):
+    cmd = ["make", "-C", os.path.join(SOURCES, design, "aie"), "--no-print-directory"] + list(args)
+    print("+ " + " ".join(cmd), file=sys.stderr)
+    if capture:
+        return subprocess.run(cmd, check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    subprocess.run(cmd, check=True, stdout=sys.stderr)
+
+
+def stage_inputs(design, frames, tmp):
+    """SIM_INPUT directory whose data/ holds every input file repeated frames times"""
+    src = os.path.join(SOURCES, design, "aie", "data")
+    os.makedirs(os.path.join(tmp, "data"), exist_ok=True)
+    os.makedirs(os.path.join(tmp, "out"), exist_ok=True)
+    for name in sorted(os.listdir(src)):
+        if name.startswith("DataInFFT") and name.endswith(".txt"):
+            text = open(os.path.join(src, name)).read()
+            if not text.endswith("\n"):
+                text += "\n"
+            with open(os.path.join(tmp, "data", name), "w") as f:
+                f.write(text * frames)
+
+
+def read_output(name):
+    """[(samples so far, time in ns)] after every data line of a simulator output file"""
+    beats, t, n = [], None, 0
+    for line in open(name):
+        tok = line.split()
+        if not tok or tok[0] == "TLAST":
+            continue
+        if tok[0] == "T":
+            t = float(tok[1]) * {"ps": 1e-3, "ns": 1.0, "us": 1e3}[tok[2]]
+            continue
+        n += len(tok) // 2
+        beats.append((n, t))
+    return beats
+
+
+def frame_times(files, frames):
+    """completion time of every frame, the last output to finish it; None without time stamps"""
+    done = [0.0] * frames
+    complete = frames
+    for name in files:
+        beats = read_output(name)
+        if not beats:
+            return None, 0
+        per_frame = beats[-1][0] // frames
+        complete = min(complete, beats[-1][0] // per_frame if per_frame else 0)
+        if beats[-1][1] is None:
+            continue
+        f = 0
+        for n, t in beats:
+            while f < frames and n >= (f + 1) * per_frame:
+                done[f] = max(done[f], t)
+                f += 1
+    if all(t == 0.0 for t in done):
+        return None, complete
+    return done, complete
+
+
+def kernel_cycles(log):
+    """mean FFT_PROFILE total per kernel, the first iteration dropped when there are more"""
+    runs = {}
+    if os.path.exists(log):
+        for line in open(log, errors="replace"):
+            m = PROFILE.search(line)
+            if m:
+                runs.setdefault("%s %s" % (m.group(1), m.group(2)), []).append((int(m.group(3)), int(m.group(4))))
+    mean = {}
+    for k, v in runs.items():
+        kept = [c for i, c in v if i > 0] or [c for _, c in v]
+        mean[k] = round(sum(kept) / len(kept), 1)
+    return mean
+
+
+def bench_sim(design, target, frames, args):
+    if not args.no_build:
+        # ITER and PROFILE are not dependencies of libadf.a, so always rebuild
+        make(design, "-B", "TARGET=" + MAKE_TARGET[target], "ITER=%d" % frames, "PROFILE=1")
+    build = make(design, "TARGET=" + MAKE_TARGET[target], "print-build-dir", capture=True).strip()
+    build = os.path.join(SOURCES, design, "aie", build)
+    tmp = tempfile.mkdtemp(prefix="fft_bench_")
+    try:
+        stage_inputs(design, frames, tmp)
+        start = time.time()
+        make(design, "TARGET=" + MAKE_TARGET[target], SIM_RULE[target],
+             "SIM_INPUT=" + tmp, "DATA_DIR=" + os.path.join(tmp, "out"))
+        wall = time.time() - start
+    finally:
+        shutil.rmtree(tmp)
+
+    out_dir = os.path.join(build, SIM_OUTPUT[target], "data")
+    files = sorted(os.path.join(out_dir, n) for n in os.listdir(out_dir) if n.startswith("DataOutFFT"))
+    done, complete = frame_times(files, frames)
+    r = {"size": design[4:], "target": target, "frames": frames, "frames_out": complete}
+    if target == "x86sim" or done is None:
+        r["wall_s"] = round(wall, 3)
+        r["wall_ms_per_frame"] = round(1e3 * wall / frames, 3)
+        return r
+
+    r["latency_ns"] = round(done[0], 1)
+    if frames > 1:
+        r["interval_ns"] = round((done[-1] - done[0]) / (frames - 1), 1)
+        r["throughput_fps"] = round(1e9 / r["interval_ns"], 1) if r["interval_ns"] > 0 else None
+        r["cycles_per_frame"] = round(r["interval_ns"] * args.aie_mhz / 1e3, 1)
+    kc = kernel_cycles(os.path.join(build, "aiesimulator.log"))
+    if kc:
+        slowest = max(kc, key=kc.get)
+        r["kernel_cycles"] = kc
+        r["bottleneck"] = slowest
+        if "cycles_per_frame" in r:
+            r["stall_cycles"] = round(r["cycles_per_frame"] - kc[slowest], 1)
+    return r
+
+
+def bench_board(batch, frames, args):
+    exe = os.path.join(SOURCES, "fft_8k", "execution", "host.exe")
+    cmd = [exe, "8", str(frames), str(batch), str(args.instances), "rr", "DataInFFT0.bin", "/dev/null"]
+    print("+ " + " ".join(cmd), file=sys.stderr)
+    out = subprocess.run(cmd, check=True, cwd=os.path.dirname(exe), stdout=subprocess.PIPE,
+                         universal_newlines=True).stdout
+    r = {"size": "8k", "target": "board", "batch": batch, "frames": frames}
+    m = re.search(r"Throughput: ([\d.]+) frames/s", out)
+    if m:
+        r["throughput_fps"] = float(m.group(1))
+    m = re.search(r"Latency per frame .*: mean ([\d.]+), min ([\d.]+), p99 ([\d.]+), max ([\d.]+)", out)
+    if m:
+        r["latency_ns"] = round(float(m.group(1)) * 1e3, 1)
+        r["latency_p99_ns"] = round(float(m.group(3)) * 1e3, 1)
+    m = re.search(r"Latency per run .*: mean ([\d.]+)", out)
+    if m:
+        r["latency_run_ns"] = round(float(m.group(1)) * 1e3, 1)
+    r["frames_out"] = frames if "TEST PASSED" in out else 0
+    return r
+
+
+def key(r):
+    return (r["size"], r["target"], r.get("batch"))
+
+
+def regressions(results, baseline, threshold):
+    base = {key(r): r for r in baseline["results"]}
+    worse = []
+    for r in results:
+        b = base.get(key(r))
+        if not b:
+            continue
+        for metric, higher_better in CHECKED.items():
+            new, old = r.get(metric), b.get(metric)
+            if new is None or old is None or old == 0:
+                continue
+            change = (new - old) / old
+            if (-change if higher_better else change) > threshold:
+                worse.append("%s %s%s: %s %.6g -> %.6g (%+.1f%%)" % (
+                    r["size"], r["target"], " batch %d" % r["batch"] if "batch" in r else "",
+                    metric, old, new, 100 * change))
+    return worse
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--sizes", default="1k,4k,8k")
+    ap.add_argument("--targets", default="x86sim,aiesim")
+    ap.add_argument("--frames", type=int, default=16, help="frames pushed through every graph")
+    ap.add_argument("--aie-mhz", type=float, default=1250, help="AIE clock for cycles_per_frame")
+    ap.add_argument("--no-build", action="store_true", help="simulate the existing builds (built with ITER=frames)")
+    ap.add_argument("--board", action="store_true", help="also run host.exe on the 8K xclbin")
+    ap.add_argument("--batches", default="1,4,16", help="frames_per_run of the board runs")
+    ap.add_argument("--board-frames", type=int, default=10000)
+    ap.add_argument("--instances", type=int, default=1)
+    ap.add_argument("--out", default="bench.json")
+    ap.add_argument("--baseline", help="earlier result file to check against")
+    ap.add_argument("--threshold", type=float, default=0.05, help="largest relative loss accepted")
+    args = ap.parse_args()
+
+    results = []
+    for size in args.sizes.split(","):
+        for target in args.targets.split(","):
+            if target not in MAKE_TARGET:
+                sys.exit("unknown target " + target)
+            results.append(bench_sim("fft_" + size, target, args.frames, args))
+    if args.board:
+        for batch in args.batches.split(","):
+            results.append(bench_board(int(batch), args.board_frames, args))
+
+    with open(args.out, "w") as f:
+        json.dump({"frames": args.frames, "aie_mhz": args.aie_mhz, "results": results}, f, indent=2)
+        f.write("\n")
+    for r in results:
+        print(json.dumps(r))
+
+    if args.baseline:
+        worse = regressions(results, json.load(open(args.baseline)), args.threshold)
+        for w in worse:
+            print("REGRESSION " + w)
+        if worse:
+            sys.exit(1)
+        print("no regression beyond %.1f%%" % (100 * args.threshold))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# Copyright (C) 2023 Advanced Micro Devices, Inc
+#
+# SPDX-License-Identifier: MIT
+
+"""Per-stage cycle breakdown of an FFT_PROFILE build.
+
+Kernels built with PROFILE=1 print one line per invocation,
+    FFT_PROFILE <kernel> <id> <iteration> <stage>=<cycles> ... total=<cycles>
+which aiesimulator and x86simulator copy to their console output (the aie
+Makefile keeps it in build.<target>/<simulator>.log). This script collects
+those lines from any number of logs (or stdin) and prints, for every kernel
+and tile id, the mean/min/max cycles of each stage and its share of the
+kernel total:
+
+    fft_profile.py build.hw/aiesimulator.log
+    fft_profile.py --skip 1 --format json -o profile.json build.hw/aiesimulator.log
+"""
+
+import argparse
+import csv
+import json
+import re
+import sys
+from collections import OrderedDict
+
+LINE = re.compile(r"FFT_PROFILE\s+(\S+)\s+(\d+)\s+(\d+)((?:\s+\w+=\d+)+)")
+
+
+def parse(files, skip):
+    """{(kernel, id): OrderedDict(stage -> [cycles of every kept invocation])}"""
+    runs = OrderedDict()
+    for f in files:
+        for line in f:
+            m = LINE.search(line)
+            if not m or int(m.group(3)) < skip:
+                continue
+            stages = runs.setdefault((m.group(1), int(m.group(2))), OrderedDict())
+            for item in m.group(4).split():
+                name, cycles = item.split("=")
+                stages.setdefault(name, []).append(int(cycles))
+    return runs
+
+
+def summarize(runs):
+    rows = []
+    for (kernel, tile), stages in runs.items():
+        total = stages.get("total", [])
+        mean_total = sum(total) / len(total) if total else 0
+        for name, cycles in stages.items():
+            mean = sum(cycles) / len(cycles)
+            rows.append(OrderedDict([
+                ("kernel", kernel),
+                ("id", tile),
+                ("stage", name),
+                ("calls", len(cycles)),
+                ("mean", round(mean, 1)),
+                ("min", min(cycles)),
+                ("max", max(cycles)),
+                ("share", round(mean / mean_total, 4) if mean_total else 0),
+            ]))
+    return rows
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("logs", nargs="*", help="simulator logs, stdin if none")
+    ap.add_argument("--skip", type=int, default=0, help="drop the first N iterations of every kernel (cold start)")
+    ap.add_argument("--format", choices=["table", "csv", "json"], default="table")
+    ap.add_argument("-o", "--output", help="write to this file instead of stdout")
+    args = ap.parse_args()
+
+    files = [open(name, errors="replace") for name in args.logs] or [sys.stdin]
+    rows = summarize(parse(files, args.skip))
+    if not rows:
+        sys.exit("no FFT_PROFILE lines found; was the graph built with PROFILE=1?")
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    if args.format == "json":
+        json.dump(rows, out, indent=2)
+        out.write("\n")
+    elif args.format == "csv":
+        w = csv.DictWriter(out, fieldnames=list(rows[0].keys()))
+        w.writeheader()
+        w.writerows(rows)
+    else:
+        out.write("%-14s %3s %-8s %6s %10s %8s %8s %6s\n" % ("kernel", "id", "stage", "calls", "mean", "min", "max", "share"))
+        for r in rows:
+            out.write("%-14s %3d %-8s %6d %10.1f %8d %8d %5.1f%%\n" % (
+                r["kernel"], r["id"], r["stage"], r["calls"], r["mean"], r["min"], r["max"], 100 * r["share"]))
+
+
+if __name__ == "__main__":
+    main()